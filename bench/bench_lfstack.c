@@ -0,0 +1,86 @@
+// Contention benchmark: N threads doing push/pop pairs on one LockFreeStack
+// versus a Stack behind one global mutex, for N = 1..16.
+
+#include "reestruct.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define TOTAL_PAIRS 2000000
+#define MAX_THREADS 16
+
+static int payload;
+
+typedef struct Worker {
+    void* stack;
+    size_t pairs;
+} Worker;
+
+typedef struct LockedStack {
+    Stack* stack;
+    pthread_mutex_t lock;
+} LockedStack;
+
+static double nowSeconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+static void* lockFreeWorker(void* arg) {
+    Worker* worker = (Worker*)arg;
+    LockFreeStack* stack = (LockFreeStack*)worker->stack;
+    for (size_t i = 0; i < worker->pairs; i++) {
+        lfstackPush(stack, &payload);
+        lfstackPop(stack);
+    }
+    return NULL;
+}
+
+static void* lockedWorker(void* arg) {
+    Worker* worker = (Worker*)arg;
+    LockedStack* locked = (LockedStack*)worker->stack;
+    for (size_t i = 0; i < worker->pairs; i++) {
+        pthread_mutex_lock(&locked->lock);
+        push(locked->stack, &payload);
+        pthread_mutex_unlock(&locked->lock);
+        pthread_mutex_lock(&locked->lock);
+        pop(locked->stack);
+        pthread_mutex_unlock(&locked->lock);
+    }
+    return NULL;
+}
+
+static double run(void* (*fn)(void*), void* stack, int threads) {
+    pthread_t ids[MAX_THREADS];
+    Worker workers[MAX_THREADS];
+    double start = nowSeconds();
+    for (int i = 0; i < threads; i++) {
+        workers[i].stack = stack;
+        workers[i].pairs = TOTAL_PAIRS / (size_t)threads;
+        pthread_create(&ids[i], NULL, fn, &workers[i]);
+    }
+    for (int i = 0; i < threads; i++) pthread_join(ids[i], NULL);
+    return nowSeconds() - start;
+}
+
+int main(void) {
+    printf("%8s %16s %16s\n", "threads", "lock-free Mops/s", "mutex Mops/s");
+    for (int threads = 1; threads <= MAX_THREADS; threads *= 2) {
+        LockFreeStack* lockFree = createLockFreeStack();
+        LockedStack locked;
+        locked.stack = createStack();
+        pthread_mutex_init(&locked.lock, NULL);
+
+        double lfTime = run(lockFreeWorker, lockFree, threads);
+        double lockedTime = run(lockedWorker, &locked, threads);
+        printf("%8d %16.2f %16.2f\n", threads,
+               2.0 * TOTAL_PAIRS / lfTime / 1e6, 2.0 * TOTAL_PAIRS / lockedTime / 1e6);
+
+        pthread_mutex_destroy(&locked.lock);
+        freeStack(locked.stack);
+        freeLockFreeStack(lockFree);
+    }
+    return 0;
+}
@@ -0,0 +1,112 @@
+// Scaling of MPMCQueue against a Queue behind one global mutex, with N
+// producers and N consumers for N = 1..64. Waiting threads yield so the run
+// completes on machines with fewer cores than threads.
+
+#include "reestruct.h"
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define TOTAL_ITEMS 2000000
+#define RING_CAPACITY 1024
+#define MAX_THREADS 64
+
+static int payload;
+
+typedef struct Worker {
+    void* queue;
+    size_t items;
+} Worker;
+
+static double nowSeconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+static void* mpmcProducer(void* arg) {
+    Worker* worker = (Worker*)arg;
+    for (size_t i = 0; i < worker->items; i++) {
+        while (!mpmcTryEnqueue((MPMCQueue*)worker->queue, &payload)) sched_yield();
+    }
+    return NULL;
+}
+
+static void* mpmcConsumer(void* arg) {
+    Worker* worker = (Worker*)arg;
+    void* item;
+    for (size_t i = 0; i < worker->items; i++) {
+        while (!mpmcTryDequeue((MPMCQueue*)worker->queue, &item)) sched_yield();
+    }
+    return NULL;
+}
+
+typedef struct LockedQueue {
+    Queue* queue;
+    pthread_mutex_t lock;
+} LockedQueue;
+
+static void* lockedProducer(void* arg) {
+    Worker* worker = (Worker*)arg;
+    LockedQueue* locked = (LockedQueue*)worker->queue;
+    for (size_t i = 0; i < worker->items; i++) {
+        pthread_mutex_lock(&locked->lock);
+        Enqueue(locked->queue, &payload);
+        pthread_mutex_unlock(&locked->lock);
+    }
+    return NULL;
+}
+
+static void* lockedConsumer(void* arg) {
+    Worker* worker = (Worker*)arg;
+    LockedQueue* locked = (LockedQueue*)worker->queue;
+    void* item;
+    for (size_t i = 0; i < worker->items; i++) {
+        for (;;) {
+            pthread_mutex_lock(&locked->lock);
+            QueueStatus status = tryDequeue(locked->queue, &item);
+            pthread_mutex_unlock(&locked->lock);
+            if (status == QUEUE_OK) break;
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+static double run(int threads, void* queue, void* (*producer)(void*), void* (*consumer)(void*)) {
+    pthread_t tids[2 * MAX_THREADS];
+    Worker workers[MAX_THREADS];
+    size_t perThread = TOTAL_ITEMS / (size_t)threads;
+    for (int i = 0; i < threads; i++) {
+        workers[i].queue = queue;
+        workers[i].items = perThread;
+    }
+    double start = nowSeconds();
+    for (int i = 0; i < threads; i++) {
+        pthread_create(&tids[i], NULL, producer, &workers[i]);
+        pthread_create(&tids[threads + i], NULL, consumer, &workers[i]);
+    }
+    for (int i = 0; i < 2 * threads; i++) pthread_join(tids[i], NULL);
+    return perThread * (size_t)threads / (nowSeconds() - start) / 1e6;
+}
+
+int main(void) {
+    printf("Producers=Consumers  MPMCQueue (Mops/s)  Queue+mutex (Mops/s)\n");
+    for (int threads = 1; threads <= MAX_THREADS; threads *= 2) {
+        MPMCQueue* mpmc = createMPMCQueue(RING_CAPACITY);
+        double mpmcRate = run(threads, mpmc, mpmcProducer, mpmcConsumer);
+        freeMPMCQueue(mpmc);
+
+        LockedQueue locked;
+        locked.queue = createQueue();
+        pthread_mutex_init(&locked.lock, NULL);
+        double lockedRate = run(threads, &locked, lockedProducer, lockedConsumer);
+        pthread_mutex_destroy(&locked.lock);
+        freeQueue(locked.queue);
+
+        printf("%19d  %18.2f  %20.2f\n", threads, mpmcRate, lockedRate);
+    }
+    return 0;
+}
@@ -0,0 +1,143 @@
+// Two-thread handoff: SPSCQueue (single and batched) vs a mutex-wrapped Queue.
+// Throughput streams ITEMS from producer to consumer; latency is half the
+// round-trip time of a ping-pong over two SPSC queues. Waiting sides yield so
+// the numbers stay meaningful when both threads share one core.
+
+#include "reestruct.h"
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define ITEMS 10000000
+#define BATCH 64
+#define PING_PONGS 200000
+#define RING_CAPACITY 4096
+
+static int payload;
+
+static double nowSeconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+static void* spscProducer(void* arg) {
+    SPSCQueue* queue = (SPSCQueue*)arg;
+    for (size_t i = 0; i < ITEMS; i++) {
+        while (!spscEnqueue(queue, &payload)) sched_yield();
+    }
+    return NULL;
+}
+
+static void* spscBatchProducer(void* arg) {
+    SPSCQueue* queue = (SPSCQueue*)arg;
+    void* items[BATCH];
+    for (size_t i = 0; i < BATCH; i++) items[i] = &payload;
+    size_t sent = 0;
+    while (sent < ITEMS) {
+        size_t want = ITEMS - sent < BATCH ? ITEMS - sent : BATCH;
+        size_t n = spscEnqueueMany(queue, items, want);
+        if (n == 0) sched_yield();
+        sent += n;
+    }
+    return NULL;
+}
+
+static void benchSpsc(bool batched) {
+    SPSCQueue* queue = createSPSCQueue(RING_CAPACITY);
+    pthread_t producer;
+    double start = nowSeconds();
+    pthread_create(&producer, NULL, batched ? spscBatchProducer : spscProducer, queue);
+    size_t received = 0;
+    void* out[BATCH];
+    while (received < ITEMS) {
+        size_t n = batched ? spscDequeueMany(queue, out, BATCH) : spscDequeue(queue, out);
+        if (n == 0) sched_yield();
+        received += n;
+    }
+    pthread_join(producer, NULL);
+    double elapsed = nowSeconds() - start;
+    printf("  SPSCQueue%-9s %8.2f Mitems/s\n", batched ? " (batch)" : "", ITEMS / elapsed / 1e6);
+    freeSPSCQueue(queue);
+}
+
+typedef struct LockedQueue {
+    Queue* queue;
+    pthread_mutex_t lock;
+} LockedQueue;
+
+static void* lockedProducer(void* arg) {
+    LockedQueue* locked = (LockedQueue*)arg;
+    for (size_t i = 0; i < ITEMS; i++) {
+        pthread_mutex_lock(&locked->lock);
+        Enqueue(locked->queue, &payload);
+        pthread_mutex_unlock(&locked->lock);
+    }
+    return NULL;
+}
+
+static void benchLockedQueue(void) {
+    LockedQueue locked;
+    locked.queue = createQueue();
+    pthread_mutex_init(&locked.lock, NULL);
+    pthread_t producer;
+    double start = nowSeconds();
+    pthread_create(&producer, NULL, lockedProducer, &locked);
+    size_t received = 0;
+    while (received < ITEMS) {
+        void* item;
+        pthread_mutex_lock(&locked.lock);
+        QueueStatus status = tryDequeue(locked.queue, &item);
+        pthread_mutex_unlock(&locked.lock);
+        if (status == QUEUE_OK) received++;
+        else sched_yield();
+    }
+    pthread_join(producer, NULL);
+    double elapsed = nowSeconds() - start;
+    printf("  Queue + mutex     %8.2f Mitems/s\n", ITEMS / elapsed / 1e6);
+    pthread_mutex_destroy(&locked.lock);
+    freeQueue(locked.queue);
+}
+
+typedef struct PingPong {
+    SPSCQueue* ping;
+    SPSCQueue* pong;
+} PingPong;
+
+static void* ponger(void* arg) {
+    PingPong* pp = (PingPong*)arg;
+    void* item;
+    for (size_t i = 0; i < PING_PONGS; i++) {
+        while (!spscDequeue(pp->ping, &item)) sched_yield();
+        while (!spscEnqueue(pp->pong, item)) sched_yield();
+    }
+    return NULL;
+}
+
+static void benchLatency(void) {
+    PingPong pp = {createSPSCQueue(16), createSPSCQueue(16)};
+    pthread_t thread;
+    pthread_create(&thread, NULL, ponger, &pp);
+    void* item;
+    double start = nowSeconds();
+    for (size_t i = 0; i < PING_PONGS; i++) {
+        while (!spscEnqueue(pp.ping, &payload)) sched_yield();
+        while (!spscDequeue(pp.pong, &item)) sched_yield();
+    }
+    double elapsed = nowSeconds() - start;
+    pthread_join(thread, NULL);
+    printf("  SPSCQueue one-way latency: %.0f ns\n", elapsed / PING_PONGS / 2 * 1e9);
+    freeSPSCQueue(pp.ping);
+    freeSPSCQueue(pp.pong);
+}
+
+int main(void) {
+    printf("Two-thread handoff of %d items:\n", ITEMS);
+    benchSpsc(false);
+    benchSpsc(true);
+    benchLockedQueue();
+    benchLatency();
+    return 0;
+}
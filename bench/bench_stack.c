@@ -0,0 +1,64 @@
+// Array-backed Stack vs the previous SLLNode-per-element linked stack, on a
+// DFS-like pattern of interleaved pushes and pops.
+
+#include "reestruct.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define OPERATIONS 20000000
+
+typedef struct LinkedStack {
+    SLLNode* top;
+    uint size;
+} LinkedStack;
+
+static void linkedPush(LinkedStack* stack, void* data) {
+    SLLNode* node = createSLLNode(data);
+    if (node == NULL) return;
+    node->next = stack->top;
+    stack->top = node;
+    stack->size++;
+}
+
+static void* linkedPop(LinkedStack* stack) {
+    SLLNode* node = stack->top;
+    void* data = node->data;
+    stack->top = node->next;
+    free(node);
+    stack->size--;
+    return data;
+}
+
+static double elapsedMs(clock_t start) {
+    return (double)(clock() - start) * 1000.0 / CLOCKS_PER_SEC;
+}
+
+int main(void) {
+    static int payload;
+    // Push two, pop one: the stack grows to OPERATIONS / 3 and then drains.
+    clock_t start = clock();
+    Stack* stack = createStack();
+    size_t checksum = 0;
+    for (size_t i = 0; i < OPERATIONS / 3; i++) {
+        push(stack, &payload);
+        push(stack, &payload);
+        checksum += pop(stack) != NULL;
+    }
+    while (!isStackEmpty(stack)) checksum += pop(stack) != NULL;
+    freeStack(stack);
+    printf("Stack ops: %d\n", OPERATIONS);
+    printf("  Array Stack:  %8.2f ms (checksum %zu)\n", elapsedMs(start), checksum);
+
+    start = clock();
+    LinkedStack linked = {NULL, 0};
+    checksum = 0;
+    for (size_t i = 0; i < OPERATIONS / 3; i++) {
+        linkedPush(&linked, &payload);
+        linkedPush(&linked, &payload);
+        checksum += linkedPop(&linked) != NULL;
+    }
+    while (linked.top != NULL) checksum += linkedPop(&linked) != NULL;
+    printf("  Linked Stack: %8.2f ms (checksum %zu)\n", elapsedMs(start), checksum);
+    return 0;
+}
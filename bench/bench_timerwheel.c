@@ -0,0 +1,112 @@
+// Timeout management under a 95% cancel rate: TimerWheel vs Heap.
+// The Heap variant uses lazy deletion (a cancelled flag), which is the only
+// option since Heap cannot remove an arbitrary element.
+
+#include "reestruct.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define TIMER_COUNT 1000000
+#define MAX_TIMEOUT 4096
+#define CANCEL_PERCENT 95
+
+typedef struct HeapTimer {
+    uint64_t expires;
+    bool cancelled;
+} HeapTimer;
+
+static size_t fired = 0;
+
+static int heapTimerCompare(const void* a, const void* b) {
+    uint64_t ea = ((const HeapTimer*)a)->expires;
+    uint64_t eb = ((const HeapTimer*)b)->expires;
+    return (ea > eb) - (ea < eb);
+}
+
+static void onFire(TimerWheelTimer* timer, void* arg) {
+    (void)timer;
+    (void)arg;
+    fired++;
+}
+
+static double elapsedMs(clock_t start) {
+    return (double)(clock() - start) * 1000.0 / CLOCKS_PER_SEC;
+}
+
+static void benchWheel(const uint64_t* timeouts, const bool* cancels) {
+    TimerWheel* wheel = createTimerWheel(0);
+    TimerWheelTimer* timers = (TimerWheelTimer*)malloc(TIMER_COUNT * sizeof(TimerWheelTimer));
+    if (wheel == NULL || timers == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed for TimerWheel benchmark\n");
+        free(timers);
+        freeTimerWheel(wheel);
+        return;
+    }
+    fired = 0;
+    clock_t start = clock();
+    for (size_t i = 0; i < TIMER_COUNT; i++) {
+        uint64_t now = i / 256;
+        timerWheelAdvance(wheel, now);
+        initTimer(&timers[i], onFire, NULL);
+        timerWheelSchedule(wheel, &timers[i], now + timeouts[i]);
+        if (cancels[i]) timerWheelCancel(wheel, &timers[i]);
+    }
+    timerWheelAdvance(wheel, TIMER_COUNT / 256 + MAX_TIMEOUT);
+    printf("  TimerWheel: %8.2f ms, fired %zu\n", elapsedMs(start), fired);
+    free(timers);
+    freeTimerWheel(wheel);
+}
+
+static void benchHeap(const uint64_t* timeouts, const bool* cancels) {
+    Heap* heap = createHeap(heapTimerCompare);
+    HeapTimer* timers = (HeapTimer*)malloc(TIMER_COUNT * sizeof(HeapTimer));
+    if (heap == NULL || timers == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed for Heap benchmark\n");
+        free(timers);
+        freeHeap(heap);
+        return;
+    }
+    size_t peak = 0;
+    fired = 0;
+    clock_t start = clock();
+    for (size_t i = 0; i < TIMER_COUNT; i++) {
+        uint64_t now = i / 256;
+        while (!heapIsEmpty(heap) && ((HeapTimer*)heap->data[0])->expires <= now) {
+            HeapTimer* timer = (HeapTimer*)heapPop(heap);
+            if (!timer->cancelled) fired++;
+        }
+        timers[i].expires = now + timeouts[i];
+        timers[i].cancelled = false;
+        heapPush(heap, &timers[i]);
+        if (cancels[i]) timers[i].cancelled = true;
+        if (heapSize(heap) > peak) peak = heapSize(heap);
+    }
+    while (!heapIsEmpty(heap)) {
+        HeapTimer* timer = (HeapTimer*)heapPop(heap);
+        if (!timer->cancelled) fired++;
+    }
+    printf("  Heap:       %8.2f ms, fired %zu, peak entries %zu\n", elapsedMs(start), fired, peak);
+    free(timers);
+    freeHeap(heap);
+}
+
+int main(void) {
+    uint64_t* timeouts = (uint64_t*)malloc(TIMER_COUNT * sizeof(uint64_t));
+    bool* cancels = (bool*)malloc(TIMER_COUNT * sizeof(bool));
+    if (timeouts == NULL || cancels == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed for benchmark input\n");
+        return 1;
+    }
+    srand(42);
+    for (size_t i = 0; i < TIMER_COUNT; i++) {
+        timeouts[i] = 1 + (uint64_t)(rand() % MAX_TIMEOUT);
+        cancels[i] = (rand() % 100) < CANCEL_PERCENT;
+    }
+    printf("Timers: %d scheduled, %d%% cancelled\n", TIMER_COUNT, CANCEL_PERCENT);
+    benchWheel(timeouts, cancels);
+    benchHeap(timeouts, cancels);
+    free(timeouts);
+    free(cancels);
+    return 0;
+}
@@ -2,13 +2,13 @@
 set -euo pipefail
 
 usage() {
-    echo "Usage: $0 [static|shared|release|all|clean|test|docs]"
+    echo "Usage: $0 [static|shared|release|all|clean|test|bench|docs]"
     echo "Default: release"
 }
 
 TARGET=${1:-release}
 case "$TARGET" in
-    static|shared|release|all|clean|test|docs) ;;
+    static|shared|release|all|clean|test|bench|docs) ;;
     *) usage; exit 1 ;;
 esac
 
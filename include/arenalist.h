@@ -0,0 +1,133 @@
+#ifndef ARENALIST_H
+#define ARENALIST_H
+#include "reestruct_export.h"
+
+#ifndef ALOCATE_SHORTCUTS
+#define ALOCATE_SHORTCUTS
+#define new(type) (type*)malloc(sizeof(type))
+#define delete(ptr) do { free(ptr); ptr = NULL; } while (0)
+#endif
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef uint32_t ArenaIndex;         /**< Node handle: slot index in the arena. */
+#define ARENA_NIL ((ArenaIndex)UINT32_MAX) /**< "No node" handle. */
+
+/** Doubly linked list whose nodes live in one contiguous arena.
+ *  Payload pointers and 32-bit next/prev indices are parallel arrays in a
+ *  single allocation (16 bytes per node on 64-bit builds, no per-node malloc),
+ *  and freed slots are recycled through an internal free list threaded via
+ *  next. Handles stay valid until their node is removed or the list is
+ *  compacted.
+ */
+typedef struct ArenaList {
+    void* block;            /**< Single allocation holding all three arrays. */
+    void** data;            /**< Payload per slot. */
+    ArenaIndex* next;       /**< Next slot (or next free slot). */
+    ArenaIndex* prev;       /**< Previous slot. */
+    ArenaIndex head;        /**< First node or ARENA_NIL. */
+    ArenaIndex tail;        /**< Last node or ARENA_NIL. */
+    ArenaIndex freeHead;    /**< First recycled slot or ARENA_NIL. */
+    ArenaIndex used;        /**< Slots ever handed out (high-water mark). */
+    ArenaIndex capacity;    /**< Allocated slots. */
+    int size;               /**< Number of elements. */
+}ArenaList;
+
+// ===================================================
+//              . . . ARENA LIST . . .
+// ===================================================
+
+/** Create empty arena list.
+ *  @param[in] capacity Initial slot count (0 allocates on first insert).
+ *  @return New list or NULL on allocation failure.
+ */
+RSTAPI ArenaList* createArenaList(ArenaIndex capacity);
+/** Deep copy of the arena with one allocation and one memcpy.
+ *  @param[in] list Source list.
+ *  @return Clone with identical handles, or NULL on allocation failure.
+ */
+RSTAPI ArenaList* AL_clone(ArenaList* list);
+
+/** Insert at front.
+ *  @param[in,out] list Target list.
+ *  @param[in] data Payload pointer (not copied).
+ *  @return Handle of the new node or ARENA_NIL on allocation failure.
+ */
+RSTAPI ArenaIndex AL_insertFront(ArenaList* list, void* data);
+/** Insert at back.
+ *  @param[in,out] list Target list.
+ *  @param[in] data Payload pointer (not copied).
+ *  @return Handle of the new node or ARENA_NIL on allocation failure.
+ */
+RSTAPI ArenaIndex AL_insertBack(ArenaList* list, void* data);
+/** Insert right after an existing node.
+ *  @param[in,out] list Target list.
+ *  @param[in] at Handle of a node in list.
+ *  @param[in] data Payload pointer (not copied).
+ *  @return Handle of the new node or ARENA_NIL on error.
+ */
+RSTAPI ArenaIndex AL_insertAfter(ArenaList* list, ArenaIndex at, void* data);
+/** Remove node by handle in O(1); its slot is recycled.
+ *  @param[in,out] list Target list.
+ *  @param[in] node Handle of a node in list.
+ *  @return Removed data pointer or NULL on invalid handle.
+ */
+RSTAPI void* AL_removeNode(ArenaList* list, ArenaIndex node);
+
+/** Get front element data.
+ *  @param[in] list Target list.
+ *  @return Data pointer or NULL if empty.
+ */
+RSTAPI void* AL_getFront(ArenaList* list);
+/** Get back element data.
+ *  @param[in] list Target list.
+ *  @return Data pointer or NULL if empty.
+ */
+RSTAPI void* AL_getBack(ArenaList* list);
+/** Get payload of a node.
+ *  @param[in] list Target list.
+ *  @param[in] node Node handle.
+ *  @return Data pointer or NULL on invalid handle.
+ */
+RSTAPI void* AL_getData(ArenaList* list, ArenaIndex node);
+/** Handle after node.
+ *  @param[in] list Target list.
+ *  @param[in] node Node handle.
+ *  @return Next handle or ARENA_NIL.
+ */
+RSTAPI ArenaIndex AL_next(ArenaList* list, ArenaIndex node);
+/** Handle before node.
+ *  @param[in] list Target list.
+ *  @param[in] node Node handle.
+ *  @return Previous handle or ARENA_NIL.
+ */
+RSTAPI ArenaIndex AL_prev(ArenaList* list, ArenaIndex node);
+
+/** Renumber nodes into list order at slots 0..size-1 and drop the free list,
+ *  so a front-to-back walk reads the arrays sequentially.
+ *  @param[in,out] list Target list.
+ *  @return True on success, false on allocation failure.
+ *  @note Invalidates all existing handles.
+ */
+RSTAPI bool AL_compact(ArenaList* list);
+
+/** Remove all elements but keep the arena allocated.
+ *  @param[in,out] list Target list.
+ *  @note Does not free stored data pointers.
+ */
+RSTAPI void AL_clearList(ArenaList* list);
+/** Free the arena and list.
+ *  @param[in,out] list Target list.
+ *  @note Does not free stored data pointers.
+ */
+RSTAPI void AL_freeList(ArenaList* list);
+
+/** Print list front->back using callback.
+ *  @param[in] list Target list.
+ *  @param[in] printFunc Callback to print a data pointer.
+ */
+RSTAPI void AL_printList(ArenaList* list, void (*printFunc)(void*));
+
+#endif
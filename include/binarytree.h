@@ -19,12 +19,26 @@ typedef struct BTNode {
     struct BTNode* left;    /**< Left child. */
     struct BTNode* right;   /**< Right child. */
     struct BTNode* parent;  /**< Parent pointer (NULL for root). */
+    uint size;              /**< Nodes in this subtree, including itself. */
+    uint height;            /**< Height of this subtree (1 for a leaf). */
 } BTNode;
 
+/** Visitor for the walk functions; return false to stop the walk early.
+ *  @param[in] data Node payload.
+ *  @param[in,out] context User context passed to the walk.
+ */
+typedef bool (*BTVisitFunc)(void* data, void* context);
+
+/** Reusable queue storage for level-order walks. */
+typedef struct BTWorkspace {
+    BTNode** queue;     /**< Node queue buffer. */
+    uint capacity;      /**< Buffer capacity in nodes. */
+} BTWorkspace;
+
 /** Binary tree container. */
 typedef struct BinaryTree {
     BTNode* root;   /**< Root node pointer. */
-    uint depth;     /**< Depth of tree (1-based). */
+    uint depth;     /**< Mirror of the root's cached height; getBinaryTreeDepth reads the root. */
 } BinaryTree;
 // ===================================================
 //                . . . BINARY TREE . . .
@@ -45,7 +59,7 @@ RSTAPI BTNode* createBTNode(void* data);
  *  @param[in] tree Tree pointer.
  */
 RSTAPI bool isBinaryTreeEmpty(BinaryTree* tree);
-/** Count total nodes.
+/** Count total nodes (O(1), read from the root's cached subtree size).
  *  @param[in] tree Tree pointer.
  */
 RSTAPI uint getBinaryTreeSize(BinaryTree* tree);
@@ -75,6 +89,46 @@ RSTAPI void postorderTraversal(BinaryTree* tree, void (*visitFunc)(void*));
  */
 RSTAPI void levelorderTraversal(BinaryTree* tree, void (*visitFunc)(void*));
 
+/** Iterative pre-order walk using parent pointers (O(1) extra space).
+ *  @param[in] tree Tree pointer.
+ *  @param[in] visitFunc Visitor; returning false stops the walk.
+ *  @param[in,out] context User context handed to visitFunc.
+ *  @return False if the visitor stopped the walk, true otherwise.
+ */
+RSTAPI bool preorderWalk(BinaryTree* tree, BTVisitFunc visitFunc, void* context);
+/** Iterative in-order walk using parent pointers (O(1) extra space).
+ *  @param[in] tree Tree pointer.
+ *  @param[in] visitFunc Visitor; returning false stops the walk.
+ *  @param[in,out] context User context handed to visitFunc.
+ *  @return False if the visitor stopped the walk, true otherwise.
+ */
+RSTAPI bool inorderWalk(BinaryTree* tree, BTVisitFunc visitFunc, void* context);
+/** Iterative post-order walk using parent pointers (O(1) extra space).
+ *  @param[in] tree Tree pointer.
+ *  @param[in] visitFunc Visitor; returning false stops the walk.
+ *  @param[in,out] context User context handed to visitFunc.
+ *  @return False if the visitor stopped the walk, true otherwise.
+ */
+RSTAPI bool postorderWalk(BinaryTree* tree, BTVisitFunc visitFunc, void* context);
+/** Level-order walk using a caller-owned workspace, grown to the tree size
+ *  only when needed, so repeated walks do not allocate.
+ *  @param[in] tree Tree pointer.
+ *  @param[in,out] workspace Reusable workspace, or NULL for a temporary one.
+ *  @param[in] visitFunc Visitor; returning false stops the walk.
+ *  @param[in,out] context User context handed to visitFunc.
+ *  @return False if the visitor stopped the walk or allocation failed, true otherwise.
+ */
+RSTAPI bool levelorderWalk(BinaryTree* tree, BTWorkspace* workspace, BTVisitFunc visitFunc, void* context);
+
+/** Create an empty level-order workspace.
+ *  @return Workspace pointer or NULL on allocation failure.
+ */
+RSTAPI BTWorkspace* createBTWorkspace(void);
+/** Free a workspace and its buffer.
+ *  @param[in,out] workspace Workspace pointer.
+ */
+RSTAPI void freeBTWorkspace(BTWorkspace* workspace);
+
 /** Get node payload.
  *  @param[in] node Node pointer.
  *  @return Payload pointer or NULL if node is NULL.
@@ -90,9 +144,9 @@ RSTAPI BTNode* getBTNodeLeft(BTNode* node);
  *  @return Right child or NULL.
  */
 RSTAPI BTNode* getBTNodeRight(BTNode* node);
-/** Get cached depth.
+/** Get depth (O(1), read from the root's cached subtree height).
  *  @param[in] tree Tree pointer.
- *  @return Depth (1 for single node).
+ *  @return Depth (1 for single node, 0 for empty tree).
  */
 RSTAPI uint getBinaryTreeDepth(BinaryTree* tree);
 /** Get root node.
@@ -117,19 +171,21 @@ RSTAPI BTNode* getBTNodeSibling(BTNode* node);
  *  @param[in] data Payload pointer.
  */
 RSTAPI void setBTNodeData(BTNode* node, void* data);
-/** Set left child and parent pointers.
+/** Set left child and parent pointers, refreshing cached sizes/heights up to the root.
  *  @param[in,out] node Parent node.
  *  @param[in,out] left New left child (parent pointer set).
  */
 RSTAPI void setBTNodeLeft(BTNode* node, BTNode* left);
-/** Set right child and parent pointers.
+/** Set right child and parent pointers, refreshing cached sizes/heights up to the root.
  *  @param[in,out] node Parent node.
  *  @param[in,out] right New right child (parent pointer set).
  */
 RSTAPI void setBTNodeRight(BTNode* node, BTNode* right);
-/** Override stored depth.
+/** Overwrite the stored depth mirror.
  *  @param[in,out] tree Tree pointer.
  *  @param[in] depth New depth value.
+ *  @note getBinaryTreeDepth always reports the root's cached height, so
+ *        this does not change the reported depth.
  */
 RSTAPI void setBinaryTreeDepth(BinaryTree* tree, uint depth);
 /** Set root pointer and reset parent/depth.
@@ -0,0 +1,72 @@
+#ifndef BLOCKINGQUEUE_H
+#define BLOCKINGQUEUE_H
+#include "deque.h"
+#include "queue.h"
+
+#include <stddef.h>
+#include <pthread.h>
+
+/** Thread-safe unbounded FIFO that consumers can sleep on.
+ *  Items live in a ring-backed Deque guarded by one mutex; consumers wait on
+ *  a condition variable that producers signal only when someone is waiting.
+ */
+typedef struct BlockingQueue {
+    Deque* items;           /**< Ring storage (guarded by lock). */
+    pthread_mutex_t lock;   /**< Protects all fields. */
+    pthread_cond_t notEmpty;/**< Signalled on enqueue and close. */
+    uint waiting;           /**< Consumers currently blocked. */
+    bool closed;            /**< Set by bqClose; rejects further enqueues. */
+} BlockingQueue;
+
+/** Create empty blocking queue.
+ *  @return Queue pointer or NULL on allocation failure.
+ */
+RSTAPI BlockingQueue* createBlockingQueue(void);
+/** Number of queued items.
+ *  @param[in] queue Queue pointer.
+ */
+RSTAPI size_t bqSize(BlockingQueue* queue);
+/** True once bqClose has been called.
+ *  @param[in] queue Queue pointer.
+ */
+RSTAPI bool bqIsClosed(BlockingQueue* queue);
+/** Enqueue one item and wake a waiting consumer.
+ *  @param[in,out] queue Queue pointer.
+ *  @param[in] item Payload pointer (not copied).
+ *  @return True on success, false if closed/NULL.
+ */
+RSTAPI bool bqEnqueue(BlockingQueue* queue, void* item);
+/** Enqueue a batch under one lock acquisition with one wakeup round.
+ *  @param[in,out] queue Queue pointer.
+ *  @param[in] items Array of payload pointers.
+ *  @param[in] count Number of items.
+ *  @return Number of items enqueued (0 if closed).
+ */
+RSTAPI size_t bqEnqueueMany(BlockingQueue* queue, void** items, size_t count);
+/** Dequeue one item, waiting up to timeoutMs.
+ *  @param[in,out] queue Queue pointer.
+ *  @param[out] out Receives the payload pointer.
+ *  @param[in] timeoutMs Milliseconds to wait; 0 polls, negative waits forever.
+ *  @return QUEUE_OK, QUEUE_TIMEOUT, QUEUE_CLOSED (closed and drained) or QUEUE_ERROR.
+ */
+RSTAPI QueueStatus bqDequeueWait(BlockingQueue* queue, void** out, long timeoutMs);
+/** Wait up to timeoutMs for items, then move up to max of them into out
+ *  under a single lock acquisition.
+ *  @param[in,out] queue Queue pointer.
+ *  @param[out] out Destination array.
+ *  @param[in] max Capacity of out.
+ *  @param[in] timeoutMs Milliseconds to wait; 0 polls, negative waits forever.
+ *  @return Number of items moved (0 on timeout, or when closed and drained).
+ */
+RSTAPI size_t bqDrainTo(BlockingQueue* queue, void** out, size_t max, long timeoutMs);
+/** Close the queue: enqueues fail, waiters wake, remaining items stay dequeuable.
+ *  @param[in,out] queue Queue pointer.
+ */
+RSTAPI void bqClose(BlockingQueue* queue);
+/** Free queue (no thread may be using it).
+ *  @param[in,out] queue Queue pointer.
+ *  @note Does not free stored payloads.
+ */
+RSTAPI void freeBlockingQueue(BlockingQueue* queue);
+
+#endif
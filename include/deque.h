@@ -5,10 +5,11 @@
 struct Deque;
 typedef unsigned int uint;
 
-/** Double-ended queue built on singly linked list nodes. */
+/** Double-ended queue built on a growable power-of-two ring buffer. */
 typedef struct Deque {
-    SLLNode* Front; /**< Front node. */
-    SLLNode* Rear;  /**< Rear node. */
+    void** data;    /**< Ring storage of payload pointers. */
+    uint capacity;  /**< Allocated slots (power of two). */
+    uint head;      /**< Index of front element in data. */
     uint size;      /**< Number of elements. */
 } Deque;
 
@@ -40,6 +41,12 @@ RSTAPI void* Deque_peekFront(Deque* queue);
  *  @return Payload pointer or NULL if empty/NULL.
  */
 RSTAPI void* Deque_peekBack(Deque* queue);
+/** Element at position from the front in O(1).
+ *  @param[in] queue Deque pointer.
+ *  @param[in] index Zero-based index (0 = front).
+ *  @return Payload pointer or NULL on invalid index/NULL.
+ */
+RSTAPI void* Deque_at(Deque* queue, uint index);
 
 /** Push at back.
  *  @param[in,out] queue Deque pointer.
@@ -61,13 +68,27 @@ RSTAPI void* popBack(Deque* queue);
  *  @return Payload pointer or NULL if empty/NULL.
  */
 RSTAPI void* popFront(Deque* queue);
+/** Push count items at the back in array order, growing storage once.
+ *  @param[in,out] queue Deque pointer.
+ *  @param[in] items Array of payload pointers.
+ *  @param[in] count Number of items.
+ *  @return Number of items pushed (0 on allocation failure).
+ */
+RSTAPI uint pushBackMany(Deque* queue, void** items, uint count);
+/** Pop up to max items from the front into out, front first.
+ *  @param[in,out] queue Deque pointer.
+ *  @param[out] out Destination array.
+ *  @param[in] max Capacity of out.
+ *  @return Number of items moved.
+ */
+RSTAPI uint dequeDrainTo(Deque* queue, void** out, uint max);
 
 /** Remove all elements but keep deque allocated.
  *  @param[in,out] queue Deque pointer.
  *  @note Does not free stored payloads.
  */
 RSTAPI void clearDeque(Deque* queue);
-/** Free all nodes and deque struct.
+/** Free storage and deque struct.
  *  @param[in,out] queue Deque pointer.
  *  @note Does not free stored payloads.
  */
@@ -0,0 +1,89 @@
+#ifndef EXTERNALPQ_H
+#define EXTERNALPQ_H
+#include "heap.h"
+#include <stdio.h>
+
+#define EPQ_MERGE_FANIN 16 /**< Runs of one level merged together into a run of the next level. */
+
+struct ExternalPQ;
+
+/** Sorted run spilled to a temporary file. */
+typedef struct EPQRun {
+    FILE* file;                 /**< Temporary file (deleted on close). */
+    size_t remaining;           /**< Records still on disk, not yet read. */
+    fpos_t blockStart;          /**< File position of the loaded block. */
+    unsigned int level;         /**< Merge level (0 for a fresh spill). */
+    char* block;                /**< Read block holding up to blockRecords records. */
+    size_t pos;                 /**< Index of current record in block. */
+    size_t len;                 /**< Records loaded in block. */
+    struct ExternalPQ* owner;   /**< Owning queue (comparator lookup). */
+} EPQRun;
+
+/** External-memory min-priority queue of fixed-size records.
+ *  Pushes go to an in-memory Heap; when it reaches the memory budget its
+ *  contents are written as a sorted run to a temporary file. Pops take the
+ *  smallest of the in-memory top and the head of every run. Runs are
+ *  merged in tiers: when EPQ_MERGE_FANIN runs share a level they become a
+ *  single run of the next level. Each record is rewritten once per level,
+ *  and at most EPQ_MERGE_FANIN - 1 runs stay open per level, so open files
+ *  and run blocks grow with log_fanin of the number of spills.
+ */
+typedef struct ExternalPQ {
+    size_t recordSize;      /**< Bytes per record. */
+    size_t bufferCapacity;  /**< Records held in memory before spilling. */
+    size_t blockRecords;    /**< Records per sequential I/O block. */
+    char* records;          /**< In-memory record slots. */
+    void** freeSlots;       /**< Stack of unused record slots. */
+    size_t freeCount;       /**< Number of unused slots. */
+    char* writeBlock;       /**< Staging block for spills. */
+    Heap* buffer;           /**< Min-heap over in-memory records. */
+    Heap* runs;             /**< Min-heap of runs by current record. */
+    size_t size;            /**< Total number of records. */
+    HeapCompare cmp;        /**< Record comparator. */
+} ExternalPQ;
+
+/** Create an external priority queue.
+ *  @param[in] recordSize Size of each record in bytes (> 0).
+ *  @param[in] memoryBudget Bytes for the in-memory buffer; each spilled run
+ *             (at most EPQ_MERGE_FANIN - 1 per level, plus one during a
+ *             merge) additionally keeps one I/O block of about 64 KiB.
+ *  @param[in] cmp Comparator on record pointers (required).
+ *  @return Queue pointer or NULL on invalid arguments/allocation failure.
+ */
+RSTAPI ExternalPQ* createExternalPQ(size_t recordSize, size_t memoryBudget, HeapCompare cmp);
+/** True if queue has no records.
+ *  @param[in] pq Queue pointer.
+ */
+RSTAPI bool epqIsEmpty(ExternalPQ* pq);
+/** Total number of records (memory and disk).
+ *  @param[in] pq Queue pointer.
+ */
+RSTAPI size_t epqSize(ExternalPQ* pq);
+/** Number of runs currently on disk.
+ *  @param[in] pq Queue pointer.
+ */
+RSTAPI size_t epqRunCount(ExternalPQ* pq);
+/** Copy a record into the queue, spilling to disk when the buffer is full.
+ *  @param[in,out] pq Queue pointer.
+ *  @param[in] record Pointer to recordSize bytes.
+ *  @return True on success, false on I/O or allocation failure.
+ */
+RSTAPI bool epqPush(ExternalPQ* pq, const void* record);
+/** Remove the smallest record, copying it into out.
+ *  @param[in,out] pq Queue pointer.
+ *  @param[out] out Destination for recordSize bytes.
+ *  @return True on success, false if empty/NULL.
+ */
+RSTAPI bool epqPop(ExternalPQ* pq, void* out);
+/** Copy the smallest record into out without removing it.
+ *  @param[in] pq Queue pointer.
+ *  @param[out] out Destination for recordSize bytes.
+ *  @return True on success, false if empty/NULL.
+ */
+RSTAPI bool epqPeek(ExternalPQ* pq, void* out);
+/** Free queue, buffers and temporary files.
+ *  @param[in,out] pq Queue pointer.
+ */
+RSTAPI void freeExternalPQ(ExternalPQ* pq);
+
+#endif
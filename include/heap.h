@@ -58,6 +58,13 @@ RSTAPI void* heapPop(Heap* heap);
  *  @return Payload pointer or NULL if empty/NULL.
  */
 RSTAPI void* heapPeek(Heap* heap);
+/** Replace smallest element with item using a single sift-down.
+ *  @param[in,out] heap Heap pointer.
+ *  @param[in] item Payload pointer that takes the top slot.
+ *  @return Previous top payload or NULL if empty/NULL.
+ *  @note Cheaper than heapPop followed by heapPush.
+ */
+RSTAPI void* heapReplaceTop(Heap* heap, void* item);
 /** Clear contents, keep allocation.
  *  @param[in,out] heap Heap pointer.
  *  @note Does not free stored payloads.
@@ -0,0 +1,106 @@
+#ifndef INTRUSIVELIST_H
+#define INTRUSIVELIST_H
+#include "reestruct_export.h"
+
+#ifndef ALOCATE_SHORTCUTS
+#define ALOCATE_SHORTCUTS
+#define new(type) (type*)malloc(sizeof(type))
+#define delete(ptr) do { free(ptr); ptr = NULL; } while (0)
+#endif
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/** Recover the enclosing object from a pointer to its embedded ListLink.
+ *  @param ptr Pointer to the ListLink member.
+ *  @param type Enclosing struct type.
+ *  @param member Name of the ListLink member in type.
+ */
+#define LIST_CONTAINER_OF(ptr, type, member) \
+    ((type*)((char*)(ptr) - offsetof(type, member)))
+
+struct ListLink;
+
+/** Link embedded in a caller-owned object. An unlinked link points to
+ *  itself, so membership is an O(1) check.
+ */
+typedef struct ListLink {
+    struct ListLink* next;  /**< Next link, NULL at the tail. */
+    struct ListLink* prev;  /**< Previous link, NULL at the head. */
+}ListLink;
+
+/** Intrusive doubly linked list: elements embed a ListLink, so insert and
+ *  remove never allocate or free anything.
+ */
+typedef struct IntrusiveList {
+    ListLink* head; /**< First link or NULL. */
+    ListLink* tail; /**< Last link or NULL. */
+    int size;       /**< Number of linked elements. */
+}IntrusiveList;
+
+// ===================================================
+//            . . . INTRUSIVE LIST . . .
+// ===================================================
+
+/** Create empty intrusive list.
+ *  @return New list or NULL on allocation failure.
+ */
+RSTAPI IntrusiveList* createIntrusiveList(void);
+/** Initialise an embedded or stack-allocated list as empty.
+ *  @param[out] list List to initialise.
+ */
+RSTAPI void IL_initList(IntrusiveList* list);
+/** Mark a link as not belonging to any list.
+ *  @param[out] link Link to initialise.
+ */
+RSTAPI void IL_initLink(ListLink* link);
+/** True if link is currently in a list.
+ *  @param[in] link Link pointer.
+ */
+RSTAPI bool IL_isLinked(ListLink* link);
+
+/** Link element at front.
+ *  @param[in,out] list Target list.
+ *  @param[in,out] link Unlinked link of the element.
+ */
+RSTAPI void IL_insertFront(IntrusiveList* list, ListLink* link);
+/** Link element at back.
+ *  @param[in,out] list Target list.
+ *  @param[in,out] link Unlinked link of the element.
+ */
+RSTAPI void IL_insertBack(IntrusiveList* list, ListLink* link);
+/** Link element right after an element already in the list.
+ *  @param[in,out] list Target list.
+ *  @param[in] pos Link already in list.
+ *  @param[in,out] link Unlinked link of the element.
+ */
+RSTAPI void IL_insertAfter(IntrusiveList* list, ListLink* pos, ListLink* link);
+/** Unlink element in O(1); the element itself is untouched.
+ *  @param[in,out] list List owning the link.
+ *  @param[in,out] link Link to remove.
+ */
+RSTAPI void IL_removeNode(IntrusiveList* list, ListLink* link);
+/** Unlink and return the front element's link.
+ *  @param[in,out] list Target list.
+ *  @return Removed link or NULL if empty.
+ */
+RSTAPI ListLink* IL_popFront(IntrusiveList* list);
+/** Unlink and return the back element's link.
+ *  @param[in,out] list Target list.
+ *  @return Removed link or NULL if empty.
+ */
+RSTAPI ListLink* IL_popBack(IntrusiveList* list);
+
+/** Unlink every element but keep list allocated.
+ *  @param[in,out] list Target list.
+ *  @note Elements are not freed.
+ */
+RSTAPI void IL_clearList(IntrusiveList* list);
+/** Unlink every element and free the list.
+ *  @param[in,out] list Target list.
+ *  @note Elements are not freed.
+ */
+RSTAPI void IL_freeList(IntrusiveList* list);
+
+#endif
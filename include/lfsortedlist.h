@@ -0,0 +1,88 @@
+#ifndef LFSORTEDLIST_H
+#define LFSORTEDLIST_H
+#include "linkedlist.h"
+#include "spscqueue.h"
+
+#include <stdint.h>
+
+#define LFSL_MAX_THREADS 64         /**< Threads that may use one list at a time. */
+#define LFSL_RETIRE_THRESHOLD 64    /**< Retired nodes per thread before an epoch advance is tried. */
+
+struct LFSLNode;
+
+/** List node. The low bit of next marks the node as logically deleted. */
+typedef struct LFSLNode {
+    void* key;                      /**< User key pointer. */
+    _Atomic(uintptr_t) next;        /**< Marked pointer to the next node. */
+    struct LFSLNode* retiredNext;   /**< Limbo chain link once unlinked. */
+}LFSLNode;
+
+/** Per-thread epoch record, padded to its own cache line. */
+typedef struct LFSLParticipant {
+    _Atomic(void*) owner;           /**< Owning thread token, NULL if free. */
+    atomic_uint state;              /**< (epoch << 1) | 1 while inside an operation, 0 otherwise. */
+    unsigned int localEpoch;        /**< Epoch seen at the last operation (owner only). */
+    LFSLNode* limbo[3];             /**< Retired nodes bucketed by epoch mod 3 (owner only). */
+    unsigned int retired;           /**< Nodes retired since the last advance attempt (owner only). */
+    char pad[RST_CACHE_LINE];       /**< Keeps neighbouring records apart. */
+}LFSLParticipant;
+
+/** Lock-free sorted set (Harris/Michael list). Insert links a node with
+ *  one CAS; remove first marks the victim's next pointer (logical delete),
+ *  then unlinks it with a CAS that any traversing thread may also perform.
+ *  Unlinked nodes are reclaimed with epoch-based reclamation: a node is
+ *  freed only after every thread has moved two epochs past its removal.
+ *  Threads join implicitly on their first operation.
+ */
+typedef struct LockFreeSortedList {
+    LFSLNode head;                  /**< Sentinel; head.next is the first node. */
+    ListCompare cmp;                /**< Key comparator. */
+    void (*freeKey)(void*);         /**< Called on a key when its node is reclaimed, or NULL. */
+    uint64_t id;                    /**< Unique list id (guards thread-local caches). */
+    atomic_size_t size;             /**< Element count. */
+    char padHead[RST_CACHE_LINE];   /**< Separates hot fields from the epoch. */
+    atomic_uint epoch;              /**< Global epoch. */
+    _Atomic(LFSLNode*) orphans;     /**< Limbo left by threads that detached. */
+    char padEpoch[RST_CACHE_LINE];  /**< Separates the epoch from participants. */
+    LFSLParticipant participants[LFSL_MAX_THREADS]; /**< Epoch records. */
+}LockFreeSortedList;
+
+/** Create empty lock-free sorted list.
+ *  @param[in] cmp Key comparator (required).
+ *  @param[in] freeKey Optional destructor for keys of reclaimed nodes.
+ *  @return List pointer or NULL on allocation failure.
+ */
+RSTAPI LockFreeSortedList* createLockFreeSortedList(ListCompare cmp, void (*freeKey)(void*));
+/** Insert key if no equal key is present (any thread).
+ *  @param[in,out] list List pointer.
+ *  @param[in] key Key pointer (owned by the list once inserted if freeKey is set).
+ *  @return True if inserted, false if a duplicate exists or on error.
+ */
+RSTAPI bool lfslInsert(LockFreeSortedList* list, void* key);
+/** Remove the element equal to key (any thread).
+ *  @param[in,out] list List pointer.
+ *  @param[in] key Probe key.
+ *  @return True if an element was removed.
+ */
+RSTAPI bool lfslRemove(LockFreeSortedList* list, const void* key);
+/** Membership test, wait-free apart from joining (any thread).
+ *  @param[in] list List pointer.
+ *  @param[in] key Probe key.
+ *  @return True if an equal key is present.
+ */
+RSTAPI bool lfslContains(LockFreeSortedList* list, const void* key);
+/** Approximate element count.
+ *  @param[in] list List pointer.
+ */
+RSTAPI size_t lfslSize(LockFreeSortedList* list);
+/** Leave the list from the calling thread, handing its pending reclamation
+ *  to the list and freeing its epoch record for other threads.
+ *  @param[in,out] list List pointer.
+ */
+RSTAPI void lfslThreadExit(LockFreeSortedList* list);
+/** Free the list, all nodes and pending reclamation (no thread may be using it).
+ *  @param[in,out] list List pointer.
+ */
+RSTAPI void freeLockFreeSortedList(LockFreeSortedList* list);
+
+#endif
@@ -0,0 +1,78 @@
+#ifndef LFSTACK_H
+#define LFSTACK_H
+#include "spscqueue.h"
+
+#include <stdint.h>
+
+#define LFSTACK_CHUNK_SHIFT 6       /**< First node chunk holds 1 << shift nodes. */
+#define LFSTACK_MAX_CHUNKS 26       /**< Doubling chunks; addresses ~2^32 nodes. */
+#define LFSTACK_ELIMINATION_SLOTS 8 /**< Exchange slots used under contention. */
+#define LFSTACK_ELIMINATION_SPINS 128 /**< Polls a pusher waits for a partner. */
+
+/** Stack node. Nodes live in chunks owned by the stack and are only
+ *  recycled, never freed, until the stack itself is freed.
+ */
+typedef struct LFStackNode {
+    _Atomic(void*) data;            /**< Payload pointer. */
+    _Atomic(uint32_t) next;         /**< Reference (index + 1) of the next node, 0 for none. */
+} LFStackNode;
+
+/** Elimination slot, padded to its own cache line. */
+typedef struct LFStackSlot {
+    _Atomic(uint64_t) offer;        /**< Tag in the high half, offered node reference in the low half. */
+    char pad[RST_CACHE_LINE - sizeof(uint64_t)]; /**< Keeps neighbouring slots apart. */
+} LFStackSlot;
+
+/** Lock-free LIFO stack (Treiber) with an elimination-backoff array.
+ *  The top and free-list heads pack a 32-bit version tag next to a 32-bit
+ *  node reference, so every successful CAS bumps the tag and a recycled
+ *  node can never be mistaken for the one a slow thread last read (ABA).
+ *  A push and a pop that both lose the CAS on top may instead pair up
+ *  through an elimination slot without touching the top at all.
+ */
+typedef struct LockFreeStack {
+    _Atomic(uint64_t) top;                  /**< Tagged reference of the top node. */
+    char padTop[RST_CACHE_LINE];            /**< Separates top from the free list. */
+    _Atomic(uint64_t) freeList;             /**< Tagged reference of the first recycled node. */
+    char padFree[RST_CACHE_LINE];           /**< Separates free list from counters. */
+    _Atomic(uint64_t) nextNode;             /**< Next never-used node index. */
+    atomic_size_t size;                     /**< Approximate element count. */
+    _Atomic(LFStackNode*) chunks[LFSTACK_MAX_CHUNKS]; /**< Node chunks, allocated on demand. */
+    LFStackSlot elimination[LFSTACK_ELIMINATION_SLOTS]; /**< Elimination-backoff array. */
+} LockFreeStack;
+
+/** Create empty lock-free stack.
+ *  @return Stack pointer or NULL on allocation failure.
+ */
+RSTAPI LockFreeStack* createLockFreeStack(void);
+/** Approximate number of elements.
+ *  @param[in] stack Stack pointer.
+ */
+RSTAPI size_t lfstackSize(LockFreeStack* stack);
+/** Return true if the stack looked empty at the time of the call.
+ *  @param[in] stack Stack pointer.
+ */
+RSTAPI bool lfstackIsEmpty(LockFreeStack* stack);
+/** Push data pointer (any thread).
+ *  @param[in,out] stack Stack pointer.
+ *  @param[in] data Payload pointer (not copied).
+ *  @return True on success, false on allocation failure.
+ */
+RSTAPI bool lfstackPush(LockFreeStack* stack, void* data);
+/** Pop and return top data pointer (any thread).
+ *  @param[in,out] stack Stack pointer.
+ *  @return Data pointer or NULL if empty/NULL.
+ */
+RSTAPI void* lfstackPop(LockFreeStack* stack);
+/** Return top data pointer without removing (snapshot; may be stale).
+ *  @param[in] stack Stack pointer.
+ *  @return Data pointer or NULL if empty/NULL.
+ */
+RSTAPI void* lfstackPeek(LockFreeStack* stack);
+/** Free stack and its nodes (no thread may be using it).
+ *  @param[in,out] stack Stack pointer.
+ *  @note Does not free stored payloads.
+ */
+RSTAPI void freeLockFreeStack(LockFreeStack* stack);
+
+#endif
@@ -15,6 +15,9 @@ struct SingleLinkedList;
 struct DLLNode;
 struct SLLNode;
 
+/** Comparator for sorting: negative if a < b, zero if equal, positive if a > b. */
+typedef int (*ListCompare)(const void* a, const void* b);
+
 /** Singly linked list node. */
 typedef struct SLLNode {
     void* data;             /**< User payload pointer. */
@@ -26,8 +29,42 @@ typedef struct SingleLinkedList {
     SLLNode* head;  /**< Head node pointer. */
     SLLNode* tail;  /**< Tail node pointer. */
     int size;       /**< Number of elements. */
+    SLLNode* cursor;    /**< Last node reached by position, NULL if unknown. */
+    int cursorIndex;    /**< Index of cursor. */
 }SingleLinkedList;
 
+/** Pool node: an SLLNode plus a back-pointer to the slab it came from. */
+typedef struct SLLPoolNode {
+    SLLNode node;               /**< Node handed out (first member). */
+    struct SLLNodeSlab* slab;   /**< Owning slab. */
+}SLLPoolNode;
+
+/** Slab of nodes carved out of one allocation for an SLLNodePool. */
+typedef struct SLLNodeSlab {
+    struct SLLNodeSlab* next;   /**< Next slab in the pool's partial or full list. */
+    struct SLLNodeSlab* prev;   /**< Previous slab in that list. */
+    SLLNode* freeList;          /**< Free nodes of this slab, linked through next. */
+    unsigned int count;         /**< Nodes in this slab. */
+    unsigned int freeCount;     /**< Nodes on this slab's free list. */
+    SLLPoolNode nodes[];        /**< Node storage. */
+}SLLNodeSlab;
+
+/** Recycling cache of SLLNodes for one container.
+ *  Nodes are refilled a slab at a time and returned to their slab on
+ *  release, so steady-state insert/remove cycles never reach malloc/free.
+ *  A slab whose nodes are all free again is returned to the system in O(1)
+ *  while the other slabs still hold at least highWater free nodes (one
+ *  slab is always kept).
+ */
+typedef struct SLLNodePool {
+    SLLNodeSlab* partial;       /**< Slabs with at least one free node. */
+    SLLNodeSlab* full;          /**< Slabs with every node in use. */
+    unsigned int freeCount;     /**< Free nodes across all slabs. */
+    unsigned int totalCount;    /**< Nodes across all slabs. */
+    unsigned int slabSize;      /**< Nodes allocated per refill. */
+    unsigned int highWater;     /**< Free nodes kept cached when slabs are released. */
+}SLLNodePool;
+
 /** Doubly linked list node. */
 typedef struct DLLNode {
     void* data;             /**< User payload pointer. */
@@ -40,6 +77,8 @@ typedef struct DoublyLinkedList {
     DLLNode* head;  /**< Head node pointer. */
     DLLNode* tail;  /**< Tail node pointer. */
     int size;       /**< Number of elements. */
+    DLLNode* cursor;    /**< Last node reached by position, NULL if unknown. */
+    int cursorIndex;    /**< Index of cursor. */
 }DoublyLinkedList;
 
 
@@ -56,6 +95,34 @@ RSTAPI SingleLinkedList* createSingleLinkedList();
  */
 RSTAPI SLLNode* createSLLNode(void* data);
 
+/** Initialise an empty node pool.
+ *  @param[out] pool Pool to initialise.
+ *  @param[in] slabSize Nodes allocated per refill (0 selects 64).
+ *  @param[in] highWater Free nodes kept cached when empty slabs are released.
+ */
+RSTAPI void SLL_initNodePool(SLLNodePool* pool, unsigned int slabSize, unsigned int highWater);
+/** Take a node from the pool, refilling it with a new slab when empty.
+ *  @param[in,out] pool Pool pointer.
+ *  @param[in] data Payload pointer stored in the node.
+ *  @return Node with next == NULL, or NULL on allocation failure.
+ */
+RSTAPI SLLNode* SLL_poolAcquire(SLLNodePool* pool, void* data);
+/** Make sure count nodes are free, allocating any shortfall as one slab.
+ *  @param[in,out] pool Pool pointer.
+ *  @param[in] count Number of nodes about to be acquired.
+ *  @return True on success, false on allocation failure.
+ */
+RSTAPI bool SLL_poolReserve(SLLNodePool* pool, unsigned int count);
+/** Return a node obtained from SLL_poolAcquire to the pool.
+ *  @param[in,out] pool Pool pointer.
+ *  @param[in] node Node to recycle (must come from this pool).
+ */
+RSTAPI void SLL_poolRelease(SLLNodePool* pool, SLLNode* node);
+/** Free every slab; nodes still in use become invalid.
+ *  @param[in,out] pool Pool pointer.
+ */
+RSTAPI void SLL_destroyNodePool(SLLNodePool* pool);
+
 /** Get node payload.
  *  @param[in] node Node pointer.
  *  @return Stored data pointer, or NULL if node is NULL.
@@ -129,6 +196,31 @@ RSTAPI void* SLL_getBack(SingleLinkedList* list);
  */
 RSTAPI void* SLL_getNode(SingleLinkedList* list, int pos);
 
+/** Move every node of src to the back of dst in O(1); src is left empty.
+ *  @param[in,out] dst Destination list.
+ *  @param[in,out] src Source list.
+ */
+RSTAPI void SLL_concat(SingleLinkedList* dst, SingleLinkedList* src);
+/** Split list after node by relinking; node becomes the new tail.
+ *  @param[in,out] list Target list.
+ *  @param[in] node Last node to keep (must belong to list), or NULL to move all.
+ *  @return New list holding the nodes after node, or NULL on error.
+ *  @note Walks the kept prefix once to count it; no node is allocated.
+ */
+RSTAPI SingleLinkedList* SLL_splitAt(SingleLinkedList* list, SLLNode* node);
+
+/** Stable in-place merge sort (bottom-up, no allocation), O(n log n).
+ *  @param[in,out] list Target list.
+ *  @param[in] cmp Comparator on data pointers.
+ */
+RSTAPI void SLL_sort(SingleLinkedList* list, ListCompare cmp);
+/** Merge sorted src into sorted dst by relinking nodes; src is left empty.
+ *  @param[in,out] dst Sorted destination list.
+ *  @param[in,out] src Sorted source list.
+ *  @param[in] cmp Comparator on data pointers (ties keep dst elements first).
+ */
+RSTAPI void SLL_mergeSorted(SingleLinkedList* dst, SingleLinkedList* src, ListCompare cmp);
+
 /** Delete all nodes but keep list allocated.
  *  @param[in,out] list Target list.
  *  @note Does not free stored data pointers.
@@ -258,6 +350,32 @@ RSTAPI void* DLL_getBack(DoublyLinkedList* list);
  */
 RSTAPI void* DLL_getNode(DoublyLinkedList* list, int pos);
 
+/** Move every node of src to the back of dst in O(1); src is left empty.
+ *  @param[in,out] dst Destination list.
+ *  @param[in,out] src Source list.
+ */
+RSTAPI void DLL_concat(DoublyLinkedList* dst, DoublyLinkedList* src);
+/** Move the run first..last out of src and insert it before a node of dst, in O(1).
+ *  @param[in,out] dst Destination list (distinct from src).
+ *  @param[in] before Node of dst to insert in front of, or NULL to append.
+ *  @param[in,out] src Source list owning the run.
+ *  @param[in] first First node of the run.
+ *  @param[in] last Last node of the run (first itself or a later node).
+ *  @param[in] count Nodes in the run, or 0 to count them by walking first..last,
+ *             which also verifies that last follows first.
+ *  @return True on success, false on invalid arguments (lists left untouched).
+ *  @note The run's end nodes and before are checked against the lists' heads
+ *        and tails; interior membership and a caller-supplied count are trusted.
+ */
+RSTAPI bool DLL_splice(DoublyLinkedList* dst, DLLNode* before, DoublyLinkedList* src, DLLNode* first, DLLNode* last,
+                       int count);
+
+/** Stable in-place merge sort (bottom-up, no allocation), O(n log n).
+ *  @param[in,out] list Target list.
+ *  @param[in] cmp Comparator on data pointers.
+ */
+RSTAPI void DLL_sort(DoublyLinkedList* list, ListCompare cmp);
+
 /** Delete all nodes but keep list allocated.
  *  @param[in,out] list Target list.
  *  @note Does not free stored data pointers.
@@ -0,0 +1,83 @@
+#ifndef MERGE_H
+#define MERGE_H
+#include "heap.h"
+#include "linkedlist.h"
+
+/** Pull callback for iterator sources.
+ *  @param[in,out] state User iterator state.
+ *  @return Next item in sorted order, or NULL when exhausted.
+ */
+typedef void* (*MergeSourceNext)(void* state);
+
+struct MergeIterator;
+
+/** Cursor over one sorted source (array, list or iterator). */
+typedef struct MergeCursor {
+    void* current;                  /**< Current front item of the source. */
+    void** array;                   /**< Array source, or NULL. */
+    size_t length;                  /**< Array length. */
+    size_t pos;                     /**< Next array index. */
+    SLLNode* node;                  /**< Next list node for list sources. */
+    MergeSourceNext next;           /**< Iterator callback, or NULL. */
+    void* state;                    /**< Iterator state. */
+    size_t order;                   /**< Insertion order, breaks ties for stability. */
+    struct MergeIterator* owner;    /**< Owning iterator (comparator lookup). */
+} MergeCursor;
+
+/** Stable k-way merge of sorted sources driven by a Heap of cursors. */
+typedef struct MergeIterator {
+    Heap* heap;             /**< Min-heap of non-exhausted cursors. */
+    MergeCursor** cursors;  /**< All cursors (for cleanup). */
+    size_t count;           /**< Number of cursors. */
+    size_t capacity;        /**< Allocated cursor slots. */
+    HeapCompare cmp;        /**< Item comparator. */
+} MergeIterator;
+
+/** Create an empty merge iterator.
+ *  @param[in] cmp Item comparator (required); every source must be sorted by it.
+ *  @return MergeIterator pointer or NULL on allocation failure.
+ */
+RSTAPI MergeIterator* createMergeIterator(HeapCompare cmp);
+/** Add a sorted array source.
+ *  @param[in,out] merge MergeIterator pointer.
+ *  @param[in] items Array of payload pointers (must outlive the iterator).
+ *  @param[in] count Number of items.
+ *  @return True on success, false on allocation failure.
+ */
+RSTAPI bool mergeAddArray(MergeIterator* merge, void** items, size_t count);
+/** Add a sorted singly linked list source (list is read, not modified).
+ *  @param[in,out] merge MergeIterator pointer.
+ *  @param[in] list Source list (must outlive the iterator).
+ *  @return True on success, false on allocation failure.
+ */
+RSTAPI bool mergeAddList(MergeIterator* merge, SingleLinkedList* list);
+/** Add a sorted iterator source.
+ *  @param[in,out] merge MergeIterator pointer.
+ *  @param[in] next Pull callback; returns NULL when exhausted (items must be non-NULL).
+ *  @param[in] state User state passed to next.
+ *  @return True on success, false on allocation failure.
+ */
+RSTAPI bool mergeAddSource(MergeIterator* merge, MergeSourceNext next, void* state);
+/** True while any source has items left.
+ *  @param[in] merge MergeIterator pointer.
+ */
+RSTAPI bool mergeHasNext(MergeIterator* merge);
+/** Return next item in merged order.
+ *  @param[in,out] merge MergeIterator pointer.
+ *  @return Payload pointer or NULL when exhausted/NULL.
+ *  @note Costs a single sift per item (replace-top on the cursor heap).
+ */
+RSTAPI void* mergeNext(MergeIterator* merge);
+/** Write up to max merged items into out.
+ *  @param[in,out] merge MergeIterator pointer.
+ *  @param[out] out Destination buffer.
+ *  @param[in] max Buffer capacity.
+ *  @return Number of items written (0 when exhausted).
+ */
+RSTAPI size_t mergeNextBatch(MergeIterator* merge, void** out, size_t max);
+/** Free iterator and cursors (sources and payloads are not freed).
+ *  @param[in,out] merge MergeIterator pointer.
+ */
+RSTAPI void freeMergeIterator(MergeIterator* merge);
+
+#endif
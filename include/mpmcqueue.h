@@ -0,0 +1,75 @@
+#ifndef MPMCQUEUE_H
+#define MPMCQUEUE_H
+#include "spscqueue.h"
+
+#include <pthread.h>
+
+/** Ring cell carrying its own sequence number. */
+typedef struct MPMCCell {
+    atomic_size_t sequence; /**< Position this cell is ready for (enqueue: pos, dequeue: pos + 1). */
+    void* data;             /**< Stored payload pointer. */
+} MPMCCell;
+
+/** Bounded multi-producer/multi-consumer array queue (Vyukov).
+ *  Producers and consumers each claim a position with one CAS on their own
+ *  counter and hand off through the cell's sequence number, so no lock is
+ *  taken on the try* paths. The blocking calls sleep on condition variables
+ *  and are only signalled when a waiter is registered.
+ */
+typedef struct MPMCQueue {
+    MPMCCell* buffer;                   /**< Cell ring (power-of-two length). */
+    size_t mask;                        /**< capacity - 1. */
+    char padShared[RST_CACHE_LINE];     /**< Separates config from enqueue counter. */
+    atomic_size_t enqueuePos;           /**< Next enqueue position. */
+    char padEnqueue[RST_CACHE_LINE];    /**< Separates enqueue and dequeue counters. */
+    atomic_size_t dequeuePos;           /**< Next dequeue position. */
+    char padDequeue[RST_CACHE_LINE];    /**< Separates dequeue counter from wait state. */
+    atomic_int waitingProducers;        /**< Producers sleeping in mpmcEnqueue. */
+    atomic_int waitingConsumers;        /**< Consumers sleeping in mpmcDequeue. */
+    pthread_mutex_t lock;               /**< Guards condition waits only. */
+    pthread_cond_t notEmpty;            /**< Signalled after an enqueue when consumers wait. */
+    pthread_cond_t notFull;             /**< Signalled after a dequeue when producers wait. */
+} MPMCQueue;
+
+/** Create MPMC queue.
+ *  @param[in] capacity Minimum slot count (rounded up to a power of two, >= 2).
+ *  @return Queue pointer or NULL on allocation failure.
+ */
+RSTAPI MPMCQueue* createMPMCQueue(size_t capacity);
+/** Slot count of the ring.
+ *  @param[in] queue Queue pointer.
+ */
+RSTAPI size_t mpmcCapacity(MPMCQueue* queue);
+/** Approximate element count under concurrency.
+ *  @param[in] queue Queue pointer.
+ */
+RSTAPI size_t mpmcSize(MPMCQueue* queue);
+/** Enqueue without blocking (lock-free).
+ *  @param[in,out] queue Queue pointer.
+ *  @param[in] item Payload pointer.
+ *  @return True on success, false if full.
+ */
+RSTAPI bool mpmcTryEnqueue(MPMCQueue* queue, void* item);
+/** Dequeue without blocking (lock-free).
+ *  @param[in,out] queue Queue pointer.
+ *  @param[out] out Receives the payload pointer.
+ *  @return True on success, false if empty.
+ */
+RSTAPI bool mpmcTryDequeue(MPMCQueue* queue, void** out);
+/** Enqueue, sleeping while the queue is full.
+ *  @param[in,out] queue Queue pointer.
+ *  @param[in] item Payload pointer.
+ */
+RSTAPI void mpmcEnqueue(MPMCQueue* queue, void* item);
+/** Dequeue, sleeping while the queue is empty.
+ *  @param[in,out] queue Queue pointer.
+ *  @return Payload pointer.
+ */
+RSTAPI void* mpmcDequeue(MPMCQueue* queue);
+/** Free queue (no thread may be using it).
+ *  @param[in,out] queue Queue pointer.
+ *  @note Does not free stored payloads.
+ */
+RSTAPI void freeMPMCQueue(MPMCQueue* queue);
+
+#endif
@@ -5,11 +5,32 @@
 struct Queue;
 
 typedef unsigned int uint;
-/** FIFO queue built on singly linked list nodes. */
+
+#define QUEUE_NODE_SLAB 64          /**< Default nodes per pool refill (linked mode). */
+#define QUEUE_NODE_HIGH_WATER 4096  /**< Default nodes kept cached after draining. */
+
+/** Result codes for non-blocking queue operations. */
+typedef enum QueueStatus {
+    QUEUE_OK = 0,   /**< Operation succeeded. */
+    QUEUE_FULL,     /**< Bounded queue has no free slot. */
+    QUEUE_EMPTY,    /**< Queue has no element to remove. */
+    QUEUE_ERROR,    /**< NULL argument or allocation failure. */
+    QUEUE_TIMEOUT,  /**< Timed wait expired with no element. */
+    QUEUE_CLOSED    /**< Queue was closed and has no element left. */
+} QueueStatus;
+
+/** FIFO queue: unbounded on singly linked list nodes, or bounded on a
+ *  fixed ring buffer when created with createQueueWithCapacity.
+ *  Linked-mode nodes come from a per-queue SLLNodePool.
+ */
 typedef struct Queue {
-    SLLNode* Front; /**< Front node. */
-    SLLNode* Rear;  /**< Rear node. */
+    SLLNode* Front; /**< Front node (linked mode). */
+    SLLNode* Rear;  /**< Rear node (linked mode). */
     uint size;      /**< Number of elements. */
+    void** ring;    /**< Ring storage (bounded mode), NULL when linked. */
+    uint capacity;  /**< Ring slot count (bounded mode). */
+    uint head;      /**< Ring index of front element (bounded mode). */
+    SLLNodePool pool; /**< Node cache (linked mode). */
 }Queue;
 
 // ===================================================
@@ -20,12 +41,26 @@ typedef struct Queue {
  *  @return New queue or NULL on allocation failure.
  */
 RSTAPI Queue* createQueue(void);
+/** Create bounded queue on a fixed ring buffer; never allocates afterwards.
+ *  @param[in] capacity Maximum element count (> 0).
+ *  @return New queue or NULL on invalid capacity/allocation failure.
+ */
+RSTAPI Queue* createQueueWithCapacity(uint capacity);
+
+/** Tune the linked-mode node cache.
+ *  @param[in,out] queue Queue pointer.
+ *  @param[in] slabSize Nodes allocated per refill (0 selects the default).
+ *  @param[in] highWater Free nodes kept cached when empty slabs are released.
+ */
+RSTAPI void setQueueNodeCache(Queue* queue, uint slabSize, uint highWater);
 
 /** Return true if queue has no elements.
  *  @param[in] queue Queue pointer.
  */
 RSTAPI bool isQueueEmpty(Queue* queue);
-/** Always false for linked queue (no fixed capacity). */
+/** True if a bounded queue has no free slot (always false when linked).
+ *  @param[in] queue Queue pointer.
+ */
 RSTAPI bool isQueueFull(Queue* queue);
 /** Number of elements.
  *  @param[in] queue Queue pointer.
@@ -47,13 +82,40 @@ RSTAPI void* Dequeue(Queue* queue);
  *  @return Payload pointer or NULL if empty/NULL.
  */
 RSTAPI void* Queue_Peek(Queue* queue);
+/** Enqueue without blocking, reporting backpressure.
+ *  @param[in,out] queue Queue pointer.
+ *  @param[in] data Payload pointer (not copied).
+ *  @return QUEUE_OK, QUEUE_FULL when bounded and full, or QUEUE_ERROR.
+ */
+RSTAPI QueueStatus tryEnqueue(Queue* queue, void* data);
+/** Dequeue without blocking.
+ *  @param[in,out] queue Queue pointer.
+ *  @param[out] out Receives the payload pointer on success.
+ *  @return QUEUE_OK, QUEUE_EMPTY, or QUEUE_ERROR.
+ */
+RSTAPI QueueStatus tryDequeue(Queue* queue, void** out);
+
+/** Enqueue count items in array order as one linked run or ring copy.
+ *  @param[in,out] queue Queue pointer.
+ *  @param[in] items Array of payload pointers.
+ *  @param[in] count Number of items.
+ *  @return Number of items enqueued (fewer if a bounded queue fills up).
+ */
+RSTAPI uint EnqueueMany(Queue* queue, void** items, uint count);
+/** Dequeue up to max items into out, front first.
+ *  @param[in,out] queue Queue pointer.
+ *  @param[out] out Destination array.
+ *  @param[in] max Capacity of out.
+ *  @return Number of items dequeued.
+ */
+RSTAPI uint DequeueMany(Queue* queue, void** out, uint max);
 
 /** Remove all elements but keep queue allocated.
  *  @param[in,out] queue Queue pointer.
  *  @note Does not free stored payloads.
  */
 RSTAPI void clearQueue(Queue* queue);
-/** Free all nodes and queue struct.
+/** Free all nodes/ring storage and queue struct.
  *  @param[in,out] queue Queue pointer.
  *  @note Does not free stored payloads.
  */
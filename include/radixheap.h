@@ -0,0 +1,83 @@
+#ifndef RADIXHEAP_H
+#define RADIXHEAP_H
+#include "reestruct_export.h"
+
+#ifndef ALOCATE_SHORTCUTS
+#define ALOCATE_SHORTCUTS
+#define new(type) (type*)malloc(sizeof(type))
+#define delete(ptr) do { free(ptr); ptr = NULL; } while (0)
+#endif
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define RADIXHEAP_BUCKETS 65 /**< One bucket per differing bit position plus "equal". */
+
+/** Key/payload pair stored in a bucket. */
+typedef struct RadixHeapEntry {
+    uint64_t key;   /**< Priority key. */
+    void* item;     /**< User payload pointer. */
+} RadixHeapEntry;
+
+/** Growable array of entries. */
+typedef struct RadixHeapBucket {
+    RadixHeapEntry* data;   /**< Entry array (NULL until first use). */
+    size_t size;            /**< Number of entries. */
+    size_t capacity;        /**< Allocated slots. */
+} RadixHeapBucket;
+
+/** Monotone min-priority queue for unsigned integer keys (no comparator).
+ *  Keys pushed must be >= the last popped key; 32-bit keys fit unchanged.
+ */
+typedef struct RadixHeap {
+    RadixHeapBucket buckets[RADIXHEAP_BUCKETS]; /**< Bucket i holds keys whose highest bit differing from last is i-1. */
+    uint64_t last;  /**< Last extracted key (lower bound for pushes). */
+    size_t size;    /**< Number of elements. */
+} RadixHeap;
+
+/** Create empty radix heap.
+ *  @return RadixHeap pointer or NULL on allocation failure.
+ */
+RSTAPI RadixHeap* createRadixHeap(void);
+/** True if heap has no elements.
+ *  @param[in] heap RadixHeap pointer.
+ */
+RSTAPI bool radixHeapIsEmpty(RadixHeap* heap);
+/** Number of elements.
+ *  @param[in] heap RadixHeap pointer.
+ */
+RSTAPI size_t radixHeapSize(RadixHeap* heap);
+/** Insert item with key.
+ *  @param[in,out] heap RadixHeap pointer.
+ *  @param[in] key Priority; must not be below the last popped key.
+ *  @param[in] item Payload pointer.
+ *  @return True on success, false on monotonicity violation or allocation failure.
+ */
+RSTAPI bool radixHeapPush(RadixHeap* heap, uint64_t key, void* item);
+/** Pop element with the smallest key.
+ *  @param[in,out] heap RadixHeap pointer.
+ *  @param[out] key Receives the popped key (may be NULL).
+ *  @return Payload pointer or NULL if empty/NULL.
+ */
+RSTAPI void* radixHeapPop(RadixHeap* heap, uint64_t* key);
+/** Peek element with the smallest key without removing; does not raise
+ *  the monotone bound (only pop does).
+ *  @param[in] heap RadixHeap pointer.
+ *  @param[out] key Receives the smallest key (may be NULL).
+ *  @return Payload pointer or NULL if empty/NULL.
+ */
+RSTAPI void* radixHeapPeek(RadixHeap* heap, uint64_t* key);
+/** Clear contents and reset the monotone lower bound to 0, keep allocation.
+ *  @param[in,out] heap RadixHeap pointer.
+ *  @note Does not free stored payloads.
+ */
+RSTAPI void clearRadixHeap(RadixHeap* heap);
+/** Free heap and bucket arrays.
+ *  @param[in,out] heap RadixHeap pointer.
+ *  @note Does not free stored payloads.
+ */
+RSTAPI void freeRadixHeap(RadixHeap* heap);
+
+#endif
@@ -2,13 +2,28 @@
 #define REESTRUCT_H
 
 #include "stack.h"
+#include "lfstack.h"
 #include "queue.h"
+#include "spscqueue.h"
+#include "mpmcqueue.h"
+#include "blockingqueue.h"
 #include "linkedlist.h"
+#include "unrolledlist.h"
+#include "intrusivelist.h"
+#include "skiplist.h"
+#include "arenalist.h"
+#include "lfsortedlist.h"
 #include "deque.h"
+#include "wsdeque.h"
 #include "binarytree.h"
 #include "graph.h"
 #include "hashtable.h"
 #include "heap.h"
+#include "topk.h"
+#include "timerwheel.h"
+#include "radixheap.h"
+#include "merge.h"
+#include "externalpq.h"
 #include "map.h"
 #include "set.h"
 #include "umap.h"
@@ -24,4 +24,11 @@
 #endif
 #endif
 
+// Thread-local storage for library internals
+#if defined(_MSC_VER) && !defined(__clang__)
+#define RST_THREAD_LOCAL __declspec(thread)
+#else
+#define RST_THREAD_LOCAL _Thread_local
+#endif
+
 #endif // REESTRUCT_EXPORT_H
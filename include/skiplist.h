@@ -0,0 +1,133 @@
+#ifndef SKIPLIST_H
+#define SKIPLIST_H
+#include "reestruct_export.h"
+
+#ifndef ALOCATE_SHORTCUTS
+#define ALOCATE_SHORTCUTS
+#define new(type) (type*)malloc(sizeof(type))
+#define delete(ptr) do { free(ptr); ptr = NULL; } while (0)
+#endif
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#define SKIPLIST_MAX_LEVEL 32 /**< Tower height cap (p = 1/4 covers 2^64 elements). */
+
+struct SkipListNode;
+
+/** Forward link of one tower level. */
+typedef struct SkipLink {
+    struct SkipListNode* next;  /**< Next node at this level, NULL at the end. */
+    int width;                  /**< Positions skipped by following next. */
+}SkipLink;
+
+/** Skip list node; links has level entries. */
+typedef struct SkipListNode {
+    void* data;                 /**< User payload pointer. */
+    struct SkipListNode* prev;  /**< Previous node at level 0 (NULL at front). */
+    int level;                  /**< Tower height. */
+    SkipLink links[];           /**< Per-level forward links. */
+}SkipListNode;
+
+/** Indexable (rank-annotated) skip list: a positional sequence with
+ *  O(log n) expected insert, remove and lookup by index, O(1) front/back
+ *  and sequential iteration along level 0.
+ */
+typedef struct IndexedSkipList {
+    SkipListNode* head; /**< Sentinel with SKIPLIST_MAX_LEVEL links. */
+    SkipListNode* tail; /**< Last node or NULL. */
+    int size;           /**< Number of elements. */
+    int level;          /**< Highest level in use. */
+    uint32_t seed;      /**< Level generator state. */
+}IndexedSkipList;
+
+// ===================================================
+//            . . . INDEXED SKIP LIST . . .
+// ===================================================
+
+/** Create empty indexed skip list.
+ *  @return New list or NULL on allocation failure.
+ */
+RSTAPI IndexedSkipList* createIndexedSkipList(void);
+
+/** Insert at front.
+ *  @param[in,out] list Target list.
+ *  @param[in] data Payload pointer (not copied).
+ */
+RSTAPI void ISL_insertFront(IndexedSkipList* list, void* data);
+/** Insert at back.
+ *  @param[in,out] list Target list.
+ *  @param[in] data Payload pointer (not copied).
+ */
+RSTAPI void ISL_insertBack(IndexedSkipList* list, void* data);
+/** Insert at position (0..size) in O(log n).
+ *  @param[in,out] list Target list.
+ *  @param[in] data Payload pointer (not copied).
+ *  @param[in] pos Zero-based index where 0 = front, size = back.
+ */
+RSTAPI void ISL_insertNode(IndexedSkipList* list, void* data, int pos);
+
+/** Remove front element.
+ *  @param[in,out] list Target list.
+ *  @return Removed data pointer or NULL if empty.
+ */
+RSTAPI void* ISL_removeFront(IndexedSkipList* list);
+/** Remove back element.
+ *  @param[in,out] list Target list.
+ *  @return Removed data pointer or NULL if empty.
+ */
+RSTAPI void* ISL_removeBack(IndexedSkipList* list);
+/** Remove element at position in O(log n).
+ *  @param[in,out] list Target list.
+ *  @param[in] pos Zero-based index.
+ *  @return Removed data pointer or NULL on invalid position.
+ */
+RSTAPI void* ISL_removeNode(IndexedSkipList* list, int pos);
+
+/** Get front element data in O(1).
+ *  @param[in] list Target list.
+ *  @return Data pointer or NULL if empty.
+ */
+RSTAPI void* ISL_getFront(IndexedSkipList* list);
+/** Get back element data in O(1).
+ *  @param[in] list Target list.
+ *  @return Data pointer or NULL if empty.
+ */
+RSTAPI void* ISL_getBack(IndexedSkipList* list);
+/** Get element data at position in O(log n).
+ *  @param[in] list Target list.
+ *  @param[in] pos Zero-based index.
+ *  @return Data pointer or NULL on invalid position.
+ */
+RSTAPI void* ISL_getNode(IndexedSkipList* list, int pos);
+
+/** First node for sequential iteration.
+ *  @param[in] list Target list.
+ *  @return Front node or NULL if empty.
+ */
+RSTAPI SkipListNode* ISL_firstNode(IndexedSkipList* list);
+/** Next node in sequence.
+ *  @param[in] node Current node.
+ *  @return Following node or NULL at the end.
+ */
+RSTAPI SkipListNode* ISL_nextNode(SkipListNode* node);
+
+/** Delete all nodes but keep list allocated.
+ *  @param[in,out] list Target list.
+ *  @note Does not free stored data pointers.
+ */
+RSTAPI void ISL_clearList(IndexedSkipList* list);
+/** Delete all nodes and free list.
+ *  @param[in,out] list Target list.
+ *  @note Does not free stored data pointers.
+ */
+RSTAPI void ISL_freeList(IndexedSkipList* list);
+
+/** Print list front->back using callback.
+ *  @param[in] list Target list.
+ *  @param[in] printFunc Callback to print a data pointer.
+ */
+RSTAPI void ISL_printList(IndexedSkipList* list, void (*printFunc)(void*));
+
+#endif
@@ -0,0 +1,82 @@
+#ifndef SPSCQUEUE_H
+#define SPSCQUEUE_H
+#include "reestruct_export.h"
+
+#ifndef ALOCATE_SHORTCUTS
+#define ALOCATE_SHORTCUTS
+#define new(type) (type*)malloc(sizeof(type))
+#define delete(ptr) do { free(ptr); ptr = NULL; } while (0)
+#endif
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdatomic.h>
+
+#ifndef RST_CACHE_LINE
+#define RST_CACHE_LINE 64 /**< Assumed cache line size for padding. */
+#endif
+
+/** Wait-free single-producer/single-consumer ring queue.
+ *  Exactly one thread may enqueue and exactly one thread may dequeue.
+ *  Producer and consumer fields are separated by full cache-line padding,
+ *  so they never share a line whatever the allocation alignment.
+ */
+typedef struct SPSCQueue {
+    void** buffer;                  /**< Ring storage (read-only after creation). */
+    size_t mask;                    /**< capacity - 1 (capacity is a power of two). */
+    char padShared[RST_CACHE_LINE]; /**< Separates shared config from consumer fields. */
+    atomic_size_t head;             /**< Next slot to read (written by consumer). */
+    size_t cachedTail;              /**< Consumer's last view of tail. */
+    char padConsumer[RST_CACHE_LINE]; /**< Separates consumer from producer fields. */
+    atomic_size_t tail;             /**< Next slot to write (written by producer). */
+    size_t cachedHead;              /**< Producer's last view of head. */
+    char padProducer[RST_CACHE_LINE]; /**< Keeps producer fields off the next allocation. */
+} SPSCQueue;
+
+/** Create SPSC queue.
+ *  @param[in] capacity Minimum slot count (rounded up to a power of two, > 0).
+ *  @return Queue pointer or NULL on invalid capacity/allocation failure.
+ */
+RSTAPI SPSCQueue* createSPSCQueue(size_t capacity);
+/** Slot count of the ring.
+ *  @param[in] queue Queue pointer.
+ */
+RSTAPI size_t spscCapacity(SPSCQueue* queue);
+/** Approximate element count (exact when called from either endpoint while the other is idle).
+ *  @param[in] queue Queue pointer.
+ */
+RSTAPI size_t spscSize(SPSCQueue* queue);
+/** Enqueue one item (producer thread only).
+ *  @param[in,out] queue Queue pointer.
+ *  @param[in] item Payload pointer.
+ *  @return True on success, false if full.
+ */
+RSTAPI bool spscEnqueue(SPSCQueue* queue, void* item);
+/** Dequeue one item (consumer thread only).
+ *  @param[in,out] queue Queue pointer.
+ *  @param[out] out Receives the payload pointer.
+ *  @return True on success, false if empty.
+ */
+RSTAPI bool spscDequeue(SPSCQueue* queue, void** out);
+/** Enqueue up to count items with a single publish (producer thread only).
+ *  @param[in,out] queue Queue pointer.
+ *  @param[in] items Array of payload pointers.
+ *  @param[in] count Number of items.
+ *  @return Number of items enqueued (fewer if the ring fills).
+ */
+RSTAPI size_t spscEnqueueMany(SPSCQueue* queue, void** items, size_t count);
+/** Dequeue up to max items with a single release (consumer thread only).
+ *  @param[in,out] queue Queue pointer.
+ *  @param[out] out Destination array.
+ *  @param[in] max Capacity of out.
+ *  @return Number of items dequeued.
+ */
+RSTAPI size_t spscDequeueMany(SPSCQueue* queue, void** out, size_t max);
+/** Free queue (no thread may be using it).
+ *  @param[in,out] queue Queue pointer.
+ *  @note Does not free stored payloads.
+ */
+RSTAPI void freeSPSCQueue(SPSCQueue* queue);
+
+#endif
@@ -5,10 +5,13 @@
 struct Stack;
 
 typedef unsigned int uint;
-/** LIFO stack built on singly linked list nodes. */
+/** LIFO stack backed by a growable array of payload pointers. */
 typedef struct Stack {
-    SLLNode* Top; /**< Top node pointer. */
-    uint size;    /**< Number of elements. */
+    void** data;        /**< Element array; top is data[size - 1]. */
+    uint size;          /**< Number of elements. */
+    uint capacity;      /**< Allocated slots. */
+    uint maxCapacity;   /**< Element cap, 0 for unbounded. */
+    uint reserved;      /**< Floor set by stackReserve; storage never shrinks below it. */
 }Stack;
 
 // ===================================================
@@ -19,12 +22,19 @@ typedef struct Stack {
  *  @return New stack or NULL on allocation failure.
  */
 RSTAPI Stack* createStack(void);
+/** Create stack capped at a maximum number of elements.
+ *  @param[in] capacity Maximum element count (0 for unbounded).
+ *  @return New stack or NULL on allocation failure.
+ */
+RSTAPI Stack* createStackWithCapacity(uint capacity);
 
 /** Return true if stack has no elements.
  *  @param[in] stack Stack pointer.
  */
 RSTAPI bool isStackEmpty(Stack* stack);
-/** Always false for linked stack (no fixed capacity). */
+/** True if stack reached its capacity cap (always false when unbounded).
+ *  @param[in] stack Stack pointer.
+ */
 RSTAPI bool isStackFull(Stack* stack);
 /** Number of elements.
  *  @param[in] stack Stack pointer.
@@ -46,13 +56,33 @@ RSTAPI void* pop(Stack* stack);
  *  @return Data pointer or NULL if empty/NULL.
  */
 RSTAPI void* Stack_Peek(Stack* stack);
+/** Grow storage so at least capacity elements fit without reallocating.
+ *  @param[in,out] stack Stack pointer.
+ *  @param[in] capacity Desired slot count (clamped to the cap if set).
+ *  @return True on success, false on allocation failure.
+ */
+RSTAPI bool stackReserve(Stack* stack, uint capacity);
+/** Push count items in array order (last item ends on top).
+ *  @param[in,out] stack Stack pointer.
+ *  @param[in] items Array of payload pointers.
+ *  @param[in] count Number of items.
+ *  @return Number of items pushed (fewer if the cap is reached).
+ */
+RSTAPI uint pushMany(Stack* stack, void** items, uint count);
+/** Pop up to max items into out, top first.
+ *  @param[in,out] stack Stack pointer.
+ *  @param[out] out Destination array.
+ *  @param[in] max Capacity of out.
+ *  @return Number of items popped.
+ */
+RSTAPI uint popMany(Stack* stack, void** out, uint max);
 
 /** Remove all elements but keep stack allocated.
  *  @param[in,out] stack Stack pointer.
  *  @note Does not free stored payloads.
  */
 RSTAPI void clearStack(Stack* stack);
-/** Free all nodes and stack struct.
+/** Free storage and stack struct.
  *  @param[in,out] stack Stack pointer.
  *  @note Does not free stored payloads.
  */
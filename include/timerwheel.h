@@ -0,0 +1,84 @@
+#ifndef TIMERWHEEL_H
+#define TIMERWHEEL_H
+#include "linkedlist.h"
+
+#include <stdlib.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define TIMERWHEEL_LEVELS 4     /**< Number of wheel levels. */
+#define TIMERWHEEL_SLOT_BITS 8  /**< log2 of slots per level. */
+#define TIMERWHEEL_SLOTS (1u << TIMERWHEEL_SLOT_BITS)
+
+struct TimerWheelTimer;
+
+/** Callback invoked when a timer expires.
+ *  @param[in,out] timer Expired timer (may be rescheduled from the callback).
+ *  @param[in] arg User argument given to initTimer.
+ */
+typedef void (*TimerCallback)(struct TimerWheelTimer* timer, void* arg);
+
+/** Timer handle, embedded in or owned by the caller (no allocation per timer). */
+typedef struct TimerWheelTimer {
+    DLLNode link;                /**< Slot list link; link.data points back at the timer. */
+    DoublyLinkedList* slot;      /**< Slot the timer is linked into, NULL if idle. */
+    uint64_t expires;            /**< Absolute expiry tick. */
+    TimerCallback callback;      /**< Expiry callback. */
+    void* arg;                   /**< User argument for callback. */
+} TimerWheelTimer;
+
+/** Hierarchical timing wheel (4 levels x 256 slots, ticks are uint64_t). */
+typedef struct TimerWheel {
+    DoublyLinkedList slots[TIMERWHEEL_LEVELS][TIMERWHEEL_SLOTS]; /**< Per-level slot lists. */
+    uint64_t current;   /**< Next tick to be processed. */
+    size_t size;        /**< Number of pending timers. */
+} TimerWheel;
+
+/** Create empty wheel starting at the given tick.
+ *  @param[in] now Current tick.
+ *  @return Wheel pointer or NULL on allocation failure.
+ */
+RSTAPI TimerWheel* createTimerWheel(uint64_t now);
+/** Initialize a caller-owned timer handle.
+ *  @param[out] timer Timer to initialize.
+ *  @param[in] callback Expiry callback (required).
+ *  @param[in] arg User argument passed to callback.
+ */
+RSTAPI void initTimer(TimerWheelTimer* timer, TimerCallback callback, void* arg);
+/** True if timer is scheduled and has not fired or been cancelled.
+ *  @param[in] timer Timer pointer.
+ */
+RSTAPI bool timerIsPending(TimerWheelTimer* timer);
+/** Schedule (or reschedule) timer to fire at an absolute tick in O(1).
+ *  @param[in,out] wheel Wheel pointer.
+ *  @param[in,out] timer Initialized timer handle.
+ *  @param[in] expires Absolute expiry tick; past ticks fire on next advance.
+ *  @return True on success, false on NULL arguments.
+ */
+RSTAPI bool timerWheelSchedule(TimerWheel* wheel, TimerWheelTimer* timer, uint64_t expires);
+/** Cancel a pending timer in O(1).
+ *  @param[in,out] wheel Wheel pointer.
+ *  @param[in,out] timer Timer handle.
+ *  @return True if the timer was pending.
+ */
+RSTAPI bool timerWheelCancel(TimerWheel* wheel, TimerWheelTimer* timer);
+/** Process all ticks up to and including now, firing expired timers.
+ *  @param[in,out] wheel Wheel pointer.
+ *  @param[in] now Current tick.
+ *  @return Number of callbacks fired.
+ */
+RSTAPI size_t timerWheelAdvance(TimerWheel* wheel, uint64_t now);
+/** Number of pending timers.
+ *  @param[in] wheel Wheel pointer.
+ */
+RSTAPI size_t timerWheelSize(TimerWheel* wheel);
+/** Unlink all pending timers without firing them.
+ *  @param[in,out] wheel Wheel pointer.
+ */
+RSTAPI void clearTimerWheel(TimerWheel* wheel);
+/** Free wheel (pending timers are unlinked, not freed).
+ *  @param[in,out] wheel Wheel pointer.
+ */
+RSTAPI void freeTimerWheel(TimerWheel* wheel);
+
+#endif
@@ -0,0 +1,62 @@
+#ifndef TOPK_H
+#define TOPK_H
+#include "heap.h"
+
+/** Bounded selector keeping the K largest items seen (by comparator). */
+typedef struct TopK {
+    Heap* heap;     /**< Min-heap of admitted items; top is the threshold. */
+    size_t k;       /**< Maximum number of items kept. */
+} TopK;
+
+/** Create a top-K selector.
+ *  @param[in] cmp Comparator (required); larger items by cmp are kept.
+ *  @param[in] k Number of items to keep (must be > 0).
+ *  @return TopK pointer or NULL on invalid arguments/allocation failure.
+ */
+RSTAPI TopK* createTopK(HeapCompare cmp, size_t k);
+/** Number of items currently kept.
+ *  @param[in] topk TopK pointer.
+ */
+RSTAPI size_t topkSize(TopK* topk);
+/** True once K items have been admitted.
+ *  @param[in] topk TopK pointer.
+ */
+RSTAPI bool topkIsFull(TopK* topk);
+/** Smallest kept item; new items must beat it once full.
+ *  @param[in] topk TopK pointer.
+ *  @return Payload pointer or NULL if empty/NULL.
+ */
+RSTAPI void* topkThreshold(TopK* topk);
+/** Offer one item to the selector.
+ *  @param[in,out] topk TopK pointer.
+ *  @param[in] item Payload pointer (not copied).
+ *  @return True if item was admitted, false if rejected or on error.
+ *  @note Items not greater than the threshold are rejected in O(1).
+ */
+RSTAPI bool topkOffer(TopK* topk, void* item);
+/** Offer a batch of items.
+ *  @param[in,out] topk TopK pointer.
+ *  @param[in] items Array of payload pointers.
+ *  @param[in] count Number of items in the array.
+ *  @return Number of items admitted.
+ */
+RSTAPI size_t topkOfferMany(TopK* topk, void** items, size_t count);
+/** Drain kept items into out, largest first, and empty the selector.
+ *  @param[in,out] topk TopK pointer.
+ *  @param[out] out Destination array.
+ *  @param[in] max Capacity of out; smallest items are dropped if fewer than topkSize.
+ *  @return Number of items written.
+ */
+RSTAPI size_t topkDrainSorted(TopK* topk, void** out, size_t max);
+/** Remove all kept items, keep allocation.
+ *  @param[in,out] topk TopK pointer.
+ *  @note Does not free stored payloads.
+ */
+RSTAPI void clearTopK(TopK* topk);
+/** Free selector and its heap.
+ *  @param[in,out] topk TopK pointer.
+ *  @note Does not free stored payloads.
+ */
+RSTAPI void freeTopK(TopK* topk);
+
+#endif
@@ -0,0 +1,140 @@
+#ifndef UNROLLEDLIST_H
+#define UNROLLEDLIST_H
+#include "reestruct_export.h"
+
+#ifndef ALOCATE_SHORTCUTS
+#define ALOCATE_SHORTCUTS
+#define new(type) (type*)malloc(sizeof(type))
+#define delete(ptr) do { free(ptr); ptr = NULL; } while (0)
+#endif
+
+#include <stdlib.h>
+#include <stdbool.h>
+
+#define UL_MIN_NODE_CAPACITY 16     /**< Smallest allowed payloads per node. */
+#define UL_MAX_NODE_CAPACITY 64     /**< Largest allowed payloads per node. */
+#define UL_DEFAULT_NODE_CAPACITY 32 /**< Payloads per node for createUnrolledList. */
+
+struct ULNode;
+
+/** Unrolled list node holding a run of payload pointers. */
+typedef struct ULNode {
+    struct ULNode* next;    /**< Next node or NULL. */
+    struct ULNode* prev;    /**< Previous node or NULL. */
+    int count;              /**< Payloads in use. */
+    void* items[];          /**< Payload pointers (list->nodeCapacity slots). */
+}ULNode;
+
+/** Unrolled linked list: a doubly linked chain of nodes, each holding up
+ *  to nodeCapacity payload pointers. Full nodes split in half on insert and
+ *  underfull neighbours merge on remove, keeping nodes at least half full
+ *  in steady state.
+ */
+typedef struct UnrolledList {
+    ULNode* head;       /**< First node. */
+    ULNode* tail;       /**< Last node. */
+    int size;           /**< Number of elements. */
+    int nodeCapacity;   /**< Payload slots per node. */
+}UnrolledList;
+
+/** Forward iterator over an UnrolledList. */
+typedef struct ULIterator {
+    ULNode* node;   /**< Current node. */
+    int index;      /**< Next slot within node. */
+}ULIterator;
+
+// ===================================================
+//            . . . UNROLLED LINKED LIST . . .
+// ===================================================
+
+/** Create empty unrolled list with the default node capacity.
+ *  @return New list or NULL on allocation failure.
+ */
+RSTAPI UnrolledList* createUnrolledList(void);
+/** Create empty unrolled list.
+ *  @param[in] nodeCapacity Payloads per node (clamped to 16..64).
+ *  @return New list or NULL on allocation failure.
+ */
+RSTAPI UnrolledList* createUnrolledListWithNodeCapacity(int nodeCapacity);
+
+/** Insert at front.
+ *  @param[in,out] list Target list.
+ *  @param[in] data Payload pointer (not copied).
+ */
+RSTAPI void UL_insertFront(UnrolledList* list, void* data);
+/** Insert at back.
+ *  @param[in,out] list Target list.
+ *  @param[in] data Payload pointer (not copied).
+ */
+RSTAPI void UL_insertBack(UnrolledList* list, void* data);
+/** Insert at position (0..size).
+ *  @param[in,out] list Target list.
+ *  @param[in] data Payload pointer (not copied).
+ *  @param[in] pos Zero-based index where 0 = front, size = back.
+ */
+RSTAPI void UL_insertNode(UnrolledList* list, void* data, int pos);
+
+/** Remove front element.
+ *  @param[in,out] list Target list.
+ *  @return Removed data pointer or NULL if empty.
+ */
+RSTAPI void* UL_removeFront(UnrolledList* list);
+/** Remove back element.
+ *  @param[in,out] list Target list.
+ *  @return Removed data pointer or NULL if empty.
+ */
+RSTAPI void* UL_removeBack(UnrolledList* list);
+/** Remove element at position.
+ *  @param[in,out] list Target list.
+ *  @param[in] pos Zero-based index.
+ *  @return Removed data pointer or NULL on invalid position.
+ */
+RSTAPI void* UL_removeNode(UnrolledList* list, int pos);
+
+/** Get front element data.
+ *  @param[in] list Target list.
+ *  @return Data pointer or NULL if empty.
+ */
+RSTAPI void* UL_getFront(UnrolledList* list);
+/** Get back element data.
+ *  @param[in] list Target list.
+ *  @return Data pointer or NULL if empty.
+ */
+RSTAPI void* UL_getBack(UnrolledList* list);
+/** Get element data at position.
+ *  @param[in] list Target list.
+ *  @param[in] pos Zero-based index.
+ *  @return Data pointer or NULL on invalid position.
+ */
+RSTAPI void* UL_getNode(UnrolledList* list, int pos);
+
+/** Start iteration at the front.
+ *  @param[in] list Target list.
+ *  @return Iterator positioned before the first element.
+ */
+RSTAPI ULIterator UL_iterBegin(UnrolledList* list);
+/** Advance iterator.
+ *  @param[in,out] it Iterator.
+ *  @param[out] out Receives the next data pointer.
+ *  @return True if an element was produced, false at the end.
+ */
+RSTAPI bool UL_iterNext(ULIterator* it, void** out);
+
+/** Delete all nodes but keep list allocated.
+ *  @param[in,out] list Target list.
+ *  @note Does not free stored data pointers.
+ */
+RSTAPI void UL_clearList(UnrolledList* list);
+/** Delete all nodes and free list.
+ *  @param[in,out] list Target list.
+ *  @note Does not free stored data pointers.
+ */
+RSTAPI void UL_freeList(UnrolledList* list);
+
+/** Print list front->back using callback.
+ *  @param[in] list Target list.
+ *  @param[in] printFunc Callback to print a data pointer.
+ */
+RSTAPI void UL_printList(UnrolledList* list, void (*printFunc)(void*));
+
+#endif
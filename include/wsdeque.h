@@ -0,0 +1,66 @@
+#ifndef WSDEQUE_H
+#define WSDEQUE_H
+#include "spscqueue.h"
+
+#include <stdint.h>
+
+/** Result of a steal attempt. */
+typedef enum WSStealResult {
+    WS_STEAL_OK = 0,    /**< An item was stolen. */
+    WS_STEAL_EMPTY,     /**< Deque was empty. */
+    WS_STEAL_ABORT      /**< Lost a race with the owner or another thief; retry. */
+} WSStealResult;
+
+/** Circular slot array; retired arrays are chained and freed with the deque. */
+typedef struct WSDequeArray {
+    size_t mask;                    /**< Slot count - 1 (power of two). */
+    struct WSDequeArray* retired;   /**< Previously replaced array, or NULL. */
+    _Atomic(void*) slots[];         /**< Item slots. */
+} WSDequeArray;
+
+/** Chase-Lev work-stealing deque.
+ *  The owning thread pushes and pops at the bottom with plain loads and
+ *  stores (plus one fence in pop); any thread may steal from the top with a
+ *  CAS. Items must be non-NULL.
+ */
+typedef struct WSDeque {
+    _Atomic(int64_t) top;               /**< Steal end (advanced by CAS). */
+    char padTop[RST_CACHE_LINE];        /**< Separates thief and owner indices. */
+    _Atomic(int64_t) bottom;            /**< Owner end. */
+    _Atomic(WSDequeArray*) array;       /**< Current slot array. */
+    char padBottom[RST_CACHE_LINE];     /**< Keeps owner fields off the next allocation. */
+} WSDeque;
+
+/** Create work-stealing deque.
+ *  @param[in] capacity Initial slot count (rounded up to a power of two).
+ *  @return Deque pointer or NULL on allocation failure.
+ */
+RSTAPI WSDeque* createWSDeque(size_t capacity);
+/** Approximate element count.
+ *  @param[in] deque Deque pointer.
+ */
+RSTAPI size_t wsdequeSize(WSDeque* deque);
+/** Push at the bottom (owner thread only); grows the array when full.
+ *  @param[in,out] deque Deque pointer.
+ *  @param[in] item Non-NULL payload pointer.
+ *  @return True on success, false on allocation failure.
+ */
+RSTAPI bool wsdequePush(WSDeque* deque, void* item);
+/** Pop from the bottom, LIFO (owner thread only).
+ *  @param[in,out] deque Deque pointer.
+ *  @return Payload pointer or NULL if empty.
+ */
+RSTAPI void* wsdequePop(WSDeque* deque);
+/** Steal from the top, FIFO (any thread).
+ *  @param[in,out] deque Deque pointer.
+ *  @param[out] out Receives the payload pointer on WS_STEAL_OK.
+ *  @return WS_STEAL_OK, WS_STEAL_EMPTY or WS_STEAL_ABORT.
+ */
+RSTAPI WSStealResult wsdequeSteal(WSDeque* deque, void** out);
+/** Free deque and all slot arrays (no thread may be using it).
+ *  @param[in,out] deque Deque pointer.
+ *  @note Does not free stored payloads.
+ */
+RSTAPI void freeWSDeque(WSDeque* deque);
+
+#endif
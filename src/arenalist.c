@@ -0,0 +1,306 @@
+#include "arenalist.h"
+#include <stdio.h>
+#include <string.h>
+
+#define ARENA_SLOT_BYTES (sizeof(void*) + 2 * sizeof(ArenaIndex))
+#define ARENA_MAX_SLOTS (ARENA_NIL - 1)
+
+// Lay out data, next and prev back to back inside block.
+static void bindArrays(ArenaList* list, void* block, ArenaIndex capacity) {
+    list->block = block;
+    list->data = (void**)block;
+    list->next = (ArenaIndex*)(list->data + capacity);
+    list->prev = list->next + capacity;
+    list->capacity = capacity;
+}
+
+static bool growArena(ArenaList* list) {
+    if (list->capacity >= ARENA_MAX_SLOTS) {
+        fprintf(stderr, "Error: ArenaList slot limit reached\n");
+        return false;
+    }
+    ArenaIndex capacity = list->capacity > 0 ? list->capacity : 4;
+    capacity = (capacity > ARENA_MAX_SLOTS / 2) ? ARENA_MAX_SLOTS : capacity * 2;
+    void* block = malloc((size_t)capacity * ARENA_SLOT_BYTES);
+    if (block == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed for ArenaList storage\n");
+        return false;
+    }
+    void** oldData = list->data;
+    ArenaIndex* oldNext = list->next;
+    ArenaIndex* oldPrev = list->prev;
+    void* oldBlock = list->block;
+    ArenaIndex used = list->used;
+    bindArrays(list, block, capacity);
+    if (used > 0) {
+        memcpy(list->data, oldData, used * sizeof(void*));
+        memcpy(list->next, oldNext, used * sizeof(ArenaIndex));
+        memcpy(list->prev, oldPrev, used * sizeof(ArenaIndex));
+    }
+    free(oldBlock);
+    return true;
+}
+
+static ArenaIndex allocSlot(ArenaList* list, void* data) {
+    ArenaIndex slot;
+    if (list->freeHead != ARENA_NIL) {
+        slot = list->freeHead;
+        list->freeHead = list->next[slot];
+    }
+    else {
+        if (list->used == list->capacity && !growArena(list)) return ARENA_NIL;
+        slot = list->used++;
+    }
+    list->data[slot] = data;
+    return slot;
+}
+
+// A slot is live if it was handed out and is not on the free list; free
+// slots are marked by prev == slot itself.
+static bool isLive(ArenaList* list, ArenaIndex node) {
+    return node < list->used && list->prev[node] != node;
+}
+
+/*      CONSTRUCTOR
+ * ==================== */
+ArenaList* createArenaList(ArenaIndex capacity) {
+    ArenaList* list = new(ArenaList);
+    if (list == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed for ArenaList\n");
+        return NULL;
+    }
+    list->block = NULL;
+    list->data = NULL;
+    list->next = NULL;
+    list->prev = NULL;
+    list->head = ARENA_NIL;
+    list->tail = ARENA_NIL;
+    list->freeHead = ARENA_NIL;
+    list->used = 0;
+    list->capacity = 0;
+    list->size = 0;
+    if (capacity > 0) {
+        if (capacity > ARENA_MAX_SLOTS) capacity = ARENA_MAX_SLOTS;
+        void* block = malloc((size_t)capacity * ARENA_SLOT_BYTES);
+        if (block == NULL) {
+            fprintf(stderr, "Error: Memory allocation failed for ArenaList storage\n");
+            delete(list);
+            return NULL;
+        }
+        bindArrays(list, block, capacity);
+    }
+    return list;
+}
+
+ArenaList* AL_clone(ArenaList* list) {
+    if (list == NULL) {
+        fprintf(stderr, "Error: List is NULL\n");
+        return NULL;
+    }
+    ArenaList* copy = new(ArenaList);
+    if (copy == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed for ArenaList\n");
+        return NULL;
+    }
+    *copy = *list;
+    if (list->capacity > 0) {
+        size_t bytes = (size_t)list->capacity * ARENA_SLOT_BYTES;
+        void* block = malloc(bytes);
+        if (block == NULL) {
+            fprintf(stderr, "Error: Memory allocation failed for ArenaList storage\n");
+            delete(copy);
+            return NULL;
+        }
+        memcpy(block, list->block, bytes);
+        bindArrays(copy, block, list->capacity);
+    }
+    return copy;
+}
+
+/*     INSERT NODE
+ * ==================== */
+ArenaIndex AL_insertFront(ArenaList* list, void* data) {
+    if (list == NULL) {
+        fprintf(stderr, "Error: List is NULL\n");
+        return ARENA_NIL;
+    }
+    ArenaIndex slot = allocSlot(list, data);
+    if (slot == ARENA_NIL) return ARENA_NIL;
+    list->prev[slot] = ARENA_NIL;
+    list->next[slot] = list->head;
+    if (list->head != ARENA_NIL) list->prev[list->head] = slot;
+    else list->tail = slot;
+    list->head = slot;
+    list->size++;
+    return slot;
+}
+
+ArenaIndex AL_insertBack(ArenaList* list, void* data) {
+    if (list == NULL) {
+        fprintf(stderr, "Error: List is NULL\n");
+        return ARENA_NIL;
+    }
+    ArenaIndex slot = allocSlot(list, data);
+    if (slot == ARENA_NIL) return ARENA_NIL;
+    list->next[slot] = ARENA_NIL;
+    list->prev[slot] = list->tail;
+    if (list->tail != ARENA_NIL) list->next[list->tail] = slot;
+    else list->head = slot;
+    list->tail = slot;
+    list->size++;
+    return slot;
+}
+
+ArenaIndex AL_insertAfter(ArenaList* list, ArenaIndex at, void* data) {
+    if (list == NULL) {
+        fprintf(stderr, "Error: List is NULL\n");
+        return ARENA_NIL;
+    }
+    if (!isLive(list, at)) {
+        fprintf(stderr, "Error: Invalid ArenaList handle\n");
+        return ARENA_NIL;
+    }
+    ArenaIndex slot = allocSlot(list, data);
+    if (slot == ARENA_NIL) return ARENA_NIL;
+    list->prev[slot] = at;
+    list->next[slot] = list->next[at];
+    if (list->next[at] != ARENA_NIL) list->prev[list->next[at]] = slot;
+    else list->tail = slot;
+    list->next[at] = slot;
+    list->size++;
+    return slot;
+}
+
+/*     REMOVE NODE
+ * ==================== */
+void* AL_removeNode(ArenaList* list, ArenaIndex node) {
+    if (list == NULL) {
+        fprintf(stderr, "Error: List is NULL\n");
+        return NULL;
+    }
+    if (!isLive(list, node)) {
+        fprintf(stderr, "Error: Invalid ArenaList handle\n");
+        return NULL;
+    }
+    ArenaIndex prev = list->prev[node];
+    ArenaIndex next = list->next[node];
+    if (prev != ARENA_NIL) list->next[prev] = next;
+    else list->head = next;
+    if (next != ARENA_NIL) list->prev[next] = prev;
+    else list->tail = prev;
+
+    void* data = list->data[node];
+    list->data[node] = NULL;
+    list->prev[node] = node;
+    list->next[node] = list->freeHead;
+    list->freeHead = node;
+    list->size--;
+    return data;
+}
+
+/*       GET NODE
+ * ==================== */
+void* AL_getFront(ArenaList* list) {
+    if (list == NULL || list->head == ARENA_NIL) {
+        fprintf(stderr, "Error: List is NULL or empty\n");
+        return NULL;
+    }
+    return list->data[list->head];
+}
+
+void* AL_getBack(ArenaList* list) {
+    if (list == NULL || list->tail == ARENA_NIL) {
+        fprintf(stderr, "Error: List is NULL or empty\n");
+        return NULL;
+    }
+    return list->data[list->tail];
+}
+
+void* AL_getData(ArenaList* list, ArenaIndex node) {
+    if (list == NULL || !isLive(list, node)) {
+        fprintf(stderr, "Error: List is NULL or handle is invalid\n");
+        return NULL;
+    }
+    return list->data[node];
+}
+
+ArenaIndex AL_next(ArenaList* list, ArenaIndex node) {
+    if (list == NULL || !isLive(list, node)) return ARENA_NIL;
+    return list->next[node];
+}
+
+ArenaIndex AL_prev(ArenaList* list, ArenaIndex node) {
+    if (list == NULL || !isLive(list, node)) return ARENA_NIL;
+    return list->prev[node];
+}
+
+/*       COMPACTION
+ * ==================== */
+bool AL_compact(ArenaList* list) {
+    if (list == NULL) {
+        fprintf(stderr, "Error: List is NULL\n");
+        return false;
+    }
+    if (list->size == 0) {
+        AL_clearList(list);
+        return true;
+    }
+    void* block = malloc((size_t)list->capacity * ARENA_SLOT_BYTES);
+    if (block == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed for ArenaList storage\n");
+        return false;
+    }
+    void** oldData = list->data;
+    ArenaIndex* oldNext = list->next;
+    void* oldBlock = list->block;
+    ArenaIndex current = list->head;
+    bindArrays(list, block, list->capacity);
+    ArenaIndex count = (ArenaIndex)list->size;
+    for (ArenaIndex i = 0; i < count; i++) {
+        list->data[i] = oldData[current];
+        list->next[i] = (i + 1 < count) ? i + 1 : ARENA_NIL;
+        list->prev[i] = (i > 0) ? i - 1 : ARENA_NIL;
+        current = oldNext[current];
+    }
+    free(oldBlock);
+    list->head = 0;
+    list->tail = count - 1;
+    list->freeHead = ARENA_NIL;
+    list->used = count;
+    return true;
+}
+
+/*  DEALOC AND DESTRUCT
+ * ==================== */
+void AL_clearList(ArenaList* list) {
+    if (list == NULL) {
+        fprintf(stderr, "Error: List is NULL\n");
+        return;
+    }
+    list->head = ARENA_NIL;
+    list->tail = ARENA_NIL;
+    list->freeHead = ARENA_NIL;
+    list->used = 0;
+    list->size = 0;
+}
+
+void AL_freeList(ArenaList* list) {
+    if (list == NULL) {
+        fprintf(stderr, "Error: List is NULL\n");
+        return;
+    }
+    free(list->block);
+    delete(list);
+}
+
+/*      PRINT LIST
+ * ==================== */
+void AL_printList(ArenaList* list, void (*printFunc)(void*)) {
+    if (list == NULL) {
+        fprintf(stderr, "Error: List is NULL\n");
+        return;
+    }
+    for (ArenaIndex node = list->head; node != ARENA_NIL; node = list->next[node]) {
+        printFunc(list->data[node]);
+    }
+}
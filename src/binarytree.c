@@ -5,93 +5,125 @@
 #include <stdio.h>
 #include <stdbool.h>
 
-static uint countNodes(const BTNode* node) {
-    if (node == NULL) return 0;
-    return 1 + countNodes(node->left) + countNodes(node->right);
+static inline uint subtreeSize(const BTNode* node) {
+    return node == NULL ? 0 : node->size;
 }
 
-static uint computeDepth(const BTNode* node) {
-    if (node == NULL) return 0;
-    uint leftDepth = computeDepth(node->left);
-    uint rightDepth = computeDepth(node->right);
-    return 1 + (leftDepth > rightDepth ? leftDepth : rightDepth);
+static inline uint subtreeHeight(const BTNode* node) {
+    return node == NULL ? 0 : node->height;
 }
 
-static void preorderHelper(BTNode* node, void (*visitFunc)(void*)) {
-    if (node == NULL) return;
-    visitFunc(node->data);
-    preorderHelper(node->left, visitFunc);
-    preorderHelper(node->right, visitFunc);
+// Recompute cached size/height from node up to the root. Ancestors only
+// depend on their children, so the walk stops once nothing changes.
+static void refreshUpward(BTNode* node) {
+    while (node != NULL) {
+        uint leftHeight = subtreeHeight(node->left);
+        uint rightHeight = subtreeHeight(node->right);
+        uint size = 1 + subtreeSize(node->left) + subtreeSize(node->right);
+        uint height = 1 + (leftHeight > rightHeight ? leftHeight : rightHeight);
+        if (size == node->size && height == node->height) return;
+        node->size = size;
+        node->height = height;
+        node = node->parent;
+    }
 }
 
-static void inorderHelper(BTNode* node, void (*visitFunc)(void*)) {
-    if (node == NULL) return;
-    inorderHelper(node->left, visitFunc);
-    visitFunc(node->data);
-    inorderHelper(node->right, visitFunc);
+// The walkers below step between nodes with parent pointers, bounded by
+// the subtree root, so deep or degenerate trees need no stack.
+static BTNode* preorderNext(BTNode* node, const BTNode* root) {
+    if (node->left != NULL) return node->left;
+    if (node->right != NULL) return node->right;
+    while (node != root) {
+        BTNode* parent = node->parent;
+        if (parent->left == node && parent->right != NULL) return parent->right;
+        node = parent;
+    }
+    return NULL;
 }
 
-static void postorderHelper(BTNode* node, void (*visitFunc)(void*)) {
-    if (node == NULL) return;
-    postorderHelper(node->left, visitFunc);
-    postorderHelper(node->right, visitFunc);
-    visitFunc(node->data);
-}
-
-static void levelorderHelper(BTNode* root, void (*visitFunc)(void*)) {
-    if (root == NULL) return;
-    size_t capacity = 16;
-    size_t front = 0;
-    size_t back = 0;
-    BTNode** queue = (BTNode**)malloc(capacity * sizeof(BTNode*));
-    if (queue == NULL) {
+static BTNode* leftmost(BTNode* node) {
+    while (node->left != NULL) node = node->left;
+    return node;
+}
+
+static BTNode* inorderNext(BTNode* node, const BTNode* root) {
+    if (node->right != NULL) return leftmost(node->right);
+    while (node != root) {
+        BTNode* parent = node->parent;
+        if (parent->left == node) return parent;
+        node = parent;
+    }
+    return NULL;
+}
+
+static BTNode* postorderFirst(BTNode* node) {
+    while (node->left != NULL || node->right != NULL) {
+        node = (node->left != NULL) ? node->left : node->right;
+    }
+    return node;
+}
+
+static BTNode* postorderNext(BTNode* node, const BTNode* root) {
+    if (node == root) return NULL;
+    BTNode* parent = node->parent;
+    if (parent->left == node && parent->right != NULL) return postorderFirst(parent->right);
+    return parent;
+}
+
+typedef struct PlainVisit {
+    void (*visitFunc)(void*);
+} PlainVisit;
+
+static bool visitPlain(void* data, void* context) {
+    ((PlainVisit*)context)->visitFunc(data);
+    return true;
+}
+
+static bool reserveWorkspace(BTWorkspace* workspace, uint needed) {
+    if (workspace->capacity >= needed) return true;
+    BTNode** resized = (BTNode**)realloc(workspace->queue, needed * sizeof(BTNode*));
+    if (resized == NULL) {
         fprintf(stderr, "Error: Memory allocation failed for traversal queue\n");
-        return;
+        return false;
     }
+    workspace->queue = resized;
+    workspace->capacity = needed;
+    return true;
+}
 
-    queue[back++] = root;
+// Every node is enqueued once, so a buffer of the cached subtree size is
+// normally enough; the in-loop growth only guards hand-linked subtrees.
+static bool levelorderHelper(BTNode* root, BTWorkspace* workspace, BTVisitFunc visitFunc, void* context) {
+    if (!reserveWorkspace(workspace, root->size > 0 ? root->size : 1)) return false;
+    uint front = 0;
+    uint back = 0;
+    workspace->queue[back++] = root;
     while (front < back) {
-        BTNode* node = queue[front++];
-        visitFunc(node->data);
-        if (node->left != NULL) {
-            if (back >= capacity) {
-                capacity *= 2;
-                BTNode** resized = (BTNode**)realloc(queue, capacity * sizeof(BTNode*));
-                if (resized == NULL) {
-                    fprintf(stderr, "Error: Memory allocation failed during traversal resize\n");
-                    free(queue);
-                    return;
-                }
-                queue = resized;
-            }
-            queue[back++] = node->left;
-        }
-        if (node->right != NULL) {
-            if (back >= capacity) {
-                capacity *= 2;
-                BTNode** resized = (BTNode**)realloc(queue, capacity * sizeof(BTNode*));
-                if (resized == NULL) {
-                    fprintf(stderr, "Error: Memory allocation failed during traversal resize\n");
-                    free(queue);
-                    return;
-                }
-                queue = resized;
-            }
-            queue[back++] = node->right;
+        BTNode* node = workspace->queue[front++];
+        if (!visitFunc(node->data, context)) return false;
+        uint children = (node->left != NULL) + (node->right != NULL);
+        if (back + children > workspace->capacity && !reserveWorkspace(workspace, workspace->capacity * 2 + 2)) {
+            return false;
         }
+        if (node->left != NULL) workspace->queue[back++] = node->left;
+        if (node->right != NULL) workspace->queue[back++] = node->right;
     }
-    free(queue);
+    return true;
 }
 
 static void destroySubtree(BTNode* node) {
     if (node == NULL) return;
-    destroySubtree(node->left);
-    destroySubtree(node->right);
-    delete(node);
+    BTNode* root = node;
+    node = postorderFirst(root);
+    while (node != NULL) {
+        BTNode* next = postorderNext(node, root);
+        delete(node);
+        node = next;
+    }
 }
 
 static void updateDepth(BinaryTree* tree) {
-    tree->depth = computeDepth(tree->root);
+    tree->depth = subtreeHeight(tree->root);
 }
 
 /*      CONSTRUCTOR
@@ -108,7 +140,7 @@ BinaryTree* createBinaryTree(void* data) {
         return NULL;
     }
     tree->root->parent = NULL;
-    tree->depth = computeDepth(tree->root);
+    updateDepth(tree);
     return tree;
 }
 
@@ -122,6 +154,8 @@ BTNode* createBTNode(void* data) {
     node->left = NULL;
     node->right = NULL;
     node->parent = NULL;
+    node->size = 1;
+    node->height = 1;
     return node;
 }
 
@@ -141,7 +175,7 @@ uint getBinaryTreeSize(BinaryTree* tree) {
         fprintf(stderr, "Error: BinaryTree is NULL\n");
         return 0;
     }
-    return countNodes(tree->root);
+    return subtreeSize(tree->root);
 }
 
 bool isLeafNode(BTNode* node) {
@@ -161,7 +195,8 @@ void preorderTraversal(BinaryTree* tree, void (*visitFunc)(void*)) {
         return;
     }
     if (visitFunc == NULL) return;
-    preorderHelper(tree->root, visitFunc);
+    PlainVisit plain = { visitFunc };
+    preorderWalk(tree, visitPlain, &plain);
 }
 
 void inorderTraversal(BinaryTree* tree, void (*visitFunc)(void*)) {
@@ -170,7 +205,8 @@ void inorderTraversal(BinaryTree* tree, void (*visitFunc)(void*)) {
         return;
     }
     if (visitFunc == NULL) return;
-    inorderHelper(tree->root, visitFunc);
+    PlainVisit plain = { visitFunc };
+    inorderWalk(tree, visitPlain, &plain);
 }
 
 void postorderTraversal(BinaryTree* tree, void (*visitFunc)(void*)) {
@@ -179,7 +215,8 @@ void postorderTraversal(BinaryTree* tree, void (*visitFunc)(void*)) {
         return;
     }
     if (visitFunc == NULL) return;
-    postorderHelper(tree->root, visitFunc);
+    PlainVisit plain = { visitFunc };
+    postorderWalk(tree, visitPlain, &plain);
 }
 
 void levelorderTraversal(BinaryTree* tree, void (*visitFunc)(void*)) {
@@ -188,7 +225,74 @@ void levelorderTraversal(BinaryTree* tree, void (*visitFunc)(void*)) {
         return;
     }
     if (visitFunc == NULL) return;
-    levelorderHelper(tree->root, visitFunc);
+    PlainVisit plain = { visitFunc };
+    levelorderWalk(tree, NULL, visitPlain, &plain);
+}
+
+bool preorderWalk(BinaryTree* tree, BTVisitFunc visitFunc, void* context) {
+    if (tree == NULL || tree->root == NULL) {
+        fprintf(stderr, "Error: BinaryTree or root is NULL\n");
+        return true;
+    }
+    if (visitFunc == NULL) return true;
+    for (BTNode* node = tree->root; node != NULL; node = preorderNext(node, tree->root)) {
+        if (!visitFunc(node->data, context)) return false;
+    }
+    return true;
+}
+
+bool inorderWalk(BinaryTree* tree, BTVisitFunc visitFunc, void* context) {
+    if (tree == NULL || tree->root == NULL) {
+        fprintf(stderr, "Error: BinaryTree or root is NULL\n");
+        return true;
+    }
+    if (visitFunc == NULL) return true;
+    for (BTNode* node = leftmost(tree->root); node != NULL; node = inorderNext(node, tree->root)) {
+        if (!visitFunc(node->data, context)) return false;
+    }
+    return true;
+}
+
+bool postorderWalk(BinaryTree* tree, BTVisitFunc visitFunc, void* context) {
+    if (tree == NULL || tree->root == NULL) {
+        fprintf(stderr, "Error: BinaryTree or root is NULL\n");
+        return true;
+    }
+    if (visitFunc == NULL) return true;
+    for (BTNode* node = postorderFirst(tree->root); node != NULL; node = postorderNext(node, tree->root)) {
+        if (!visitFunc(node->data, context)) return false;
+    }
+    return true;
+}
+
+bool levelorderWalk(BinaryTree* tree, BTWorkspace* workspace, BTVisitFunc visitFunc, void* context) {
+    if (tree == NULL || tree->root == NULL) {
+        fprintf(stderr, "Error: BinaryTree or root is NULL\n");
+        return true;
+    }
+    if (visitFunc == NULL) return true;
+    if (workspace != NULL) return levelorderHelper(tree->root, workspace, visitFunc, context);
+    BTWorkspace scratch = { NULL, 0 };
+    bool completed = levelorderHelper(tree->root, &scratch, visitFunc, context);
+    free(scratch.queue);
+    return completed;
+}
+
+BTWorkspace* createBTWorkspace(void) {
+    BTWorkspace* workspace = new(BTWorkspace);
+    if (workspace == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed for BTWorkspace\n");
+        return NULL;
+    }
+    workspace->queue = NULL;
+    workspace->capacity = 0;
+    return workspace;
+}
+
+void freeBTWorkspace(BTWorkspace* workspace) {
+    if (workspace == NULL) return;
+    free(workspace->queue);
+    delete(workspace);
 }
 
 
@@ -223,7 +327,7 @@ uint getBinaryTreeDepth(BinaryTree* tree) {
         fprintf(stderr, "Error: BinaryTree is NULL\n");
         return 0;
     }
-    return tree->depth;
+    return subtreeHeight(tree->root);
 }
 
 BTNode* getBinaryTreeRoot(BinaryTree* tree) {
@@ -272,6 +376,7 @@ void setBTNodeLeft(BTNode* node, BTNode* left) {
     }
     node->left = left;
     if (left != NULL) left->parent = node;
+    refreshUpward(node);
 }
 
 void setBTNodeRight(BTNode* node, BTNode* right) {
@@ -281,6 +386,7 @@ void setBTNodeRight(BTNode* node, BTNode* right) {
     }
     node->right = right;
     if (right != NULL) right->parent = node;
+    refreshUpward(node);
 }
 
 void setBinaryTreeDepth(BinaryTree* tree, uint depth) {
@@ -322,6 +428,7 @@ void setBTNodeSibling(BTNode* node, BTNode* sibling) {
         node->parent->left = sibling;
     }
     if (sibling != NULL) sibling->parent = node->parent;
+    refreshUpward(node->parent);
 }
 
 
@@ -339,6 +446,9 @@ void insertLeft(BinaryTree* tree, BTNode* parent, void* data) {
     if (newNode->left != NULL) newNode->left->parent = newNode;
     parent->left = newNode;
     newNode->parent = parent;
+    newNode->size = 1 + subtreeSize(newNode->left);
+    newNode->height = 1 + subtreeHeight(newNode->left);
+    refreshUpward(parent);
     updateDepth(tree);
 }
 
@@ -354,6 +464,9 @@ void insertRight(BinaryTree* tree, BTNode* parent, void* data) {
     if (newNode->right != NULL) newNode->right->parent = newNode;
     parent->right = newNode;
     newNode->parent = parent;
+    newNode->size = 1 + subtreeSize(newNode->right);
+    newNode->height = 1 + subtreeHeight(newNode->right);
+    refreshUpward(parent);
     updateDepth(tree);
 }
 
@@ -362,12 +475,14 @@ void removeNode(BinaryTree* tree, BTNode* node) {
         fprintf(stderr, "Error: BinaryTree or node is NULL\n");
         return;
     }
-    if (node->parent != NULL) {
-        if (node->parent->left == node) {
-            node->parent->left = NULL;
-        } else if (node->parent->right == node) {
-            node->parent->right = NULL;
+    BTNode* parent = node->parent;
+    if (parent != NULL) {
+        if (parent->left == node) {
+            parent->left = NULL;
+        } else if (parent->right == node) {
+            parent->right = NULL;
         }
+        refreshUpward(parent);
     } else {
         tree->root = NULL;
     }
@@ -410,7 +525,8 @@ void printBinaryTree(BinaryTree* tree, void (*printFunc)(void*)) {
         return;
     }
     if (tree->root == NULL || printFunc == NULL) return;
-    inorderHelper(tree->root, printFunc);
+    PlainVisit plain = { printFunc };
+    inorderWalk(tree, visitPlain, &plain);
     printf("\n");
 }
 
@@ -0,0 +1,176 @@
+#include "blockingqueue.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include <errno.h>
+
+// Timed waits use CLOCK_MONOTONIC where the condvar clock can be chosen, so
+// wall-clock adjustments cannot stretch or cut a timeout.
+#if defined(CLOCK_MONOTONIC) && !defined(__APPLE__)
+#define BQ_CLOCK CLOCK_MONOTONIC
+#else
+#define BQ_CLOCK CLOCK_REALTIME
+#endif
+
+static struct timespec deadlineAfter(long timeoutMs) {
+    struct timespec ts;
+    clock_gettime(BQ_CLOCK, &ts);
+    ts.tv_sec += timeoutMs / 1000;
+    ts.tv_nsec += (timeoutMs % 1000) * 1000000L;
+    if (ts.tv_nsec >= 1000000000L) {
+        ts.tv_sec++;
+        ts.tv_nsec -= 1000000000L;
+    }
+    return ts;
+}
+
+// Wait with the lock held until an item is queued, the queue is closed or the
+// timeout passes. Returns true if at least one item is available.
+static bool waitForItems(BlockingQueue* queue, long timeoutMs) {
+    if (queue->items->size > 0) return true;
+    if (queue->closed || timeoutMs == 0) return false;
+    struct timespec deadline = {0, 0};
+    if (timeoutMs > 0) deadline = deadlineAfter(timeoutMs);
+    queue->waiting++;
+    while (queue->items->size == 0 && !queue->closed) {
+        if (timeoutMs < 0) {
+            pthread_cond_wait(&queue->notEmpty, &queue->lock);
+        } else if (pthread_cond_timedwait(&queue->notEmpty, &queue->lock, &deadline) == ETIMEDOUT) {
+            break;
+        }
+    }
+    queue->waiting--;
+    return queue->items->size > 0;
+}
+
+BlockingQueue* createBlockingQueue(void) {
+    BlockingQueue* queue = new(BlockingQueue);
+    if (queue == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed for BlockingQueue\n");
+        return NULL;
+    }
+    queue->items = createDeque();
+    if (queue->items == NULL) {
+        delete(queue);
+        return NULL;
+    }
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+#if defined(CLOCK_MONOTONIC) && !defined(__APPLE__)
+    pthread_condattr_setclock(&attr, BQ_CLOCK);
+#endif
+    pthread_cond_init(&queue->notEmpty, &attr);
+    pthread_condattr_destroy(&attr);
+    pthread_mutex_init(&queue->lock, NULL);
+    queue->waiting = 0;
+    queue->closed = false;
+    return queue;
+}
+
+size_t bqSize(BlockingQueue* queue) {
+    if (queue == NULL) {
+        fprintf(stderr, "Error: BlockingQueue is NULL\n");
+        return 0;
+    }
+    pthread_mutex_lock(&queue->lock);
+    size_t size = queue->items->size;
+    pthread_mutex_unlock(&queue->lock);
+    return size;
+}
+
+bool bqIsClosed(BlockingQueue* queue) {
+    if (queue == NULL) {
+        fprintf(stderr, "Error: BlockingQueue is NULL\n");
+        return true;
+    }
+    pthread_mutex_lock(&queue->lock);
+    bool closed = queue->closed;
+    pthread_mutex_unlock(&queue->lock);
+    return closed;
+}
+
+bool bqEnqueue(BlockingQueue* queue, void* item) {
+    return bqEnqueueMany(queue, &item, 1) == 1;
+}
+
+size_t bqEnqueueMany(BlockingQueue* queue, void** items, size_t count) {
+    if (queue == NULL || items == NULL) {
+        fprintf(stderr, "Error: BlockingQueue or items array is NULL\n");
+        return 0;
+    }
+    pthread_mutex_lock(&queue->lock);
+    if (queue->closed) {
+        pthread_mutex_unlock(&queue->lock);
+        return 0;
+    }
+    size_t added = 0;
+    for (; added < count; added++) {
+        uint before = queue->items->size;
+        pushBack(queue->items, items[added]);
+        if (queue->items->size == before) break;
+    }
+    // One wakeup per batch: a single item needs one consumer, a batch may
+    // feed every sleeper.
+    if (queue->waiting > 0 && added > 0) {
+        if (added == 1) {
+            pthread_cond_signal(&queue->notEmpty);
+        } else {
+            pthread_cond_broadcast(&queue->notEmpty);
+        }
+    }
+    pthread_mutex_unlock(&queue->lock);
+    return added;
+}
+
+QueueStatus bqDequeueWait(BlockingQueue* queue, void** out, long timeoutMs) {
+    if (queue == NULL || out == NULL) {
+        fprintf(stderr, "Error: BlockingQueue or output is NULL\n");
+        return QUEUE_ERROR;
+    }
+    pthread_mutex_lock(&queue->lock);
+    QueueStatus status;
+    if (waitForItems(queue, timeoutMs)) {
+        *out = popFront(queue->items);
+        status = QUEUE_OK;
+    } else {
+        status = queue->closed ? QUEUE_CLOSED : QUEUE_TIMEOUT;
+    }
+    pthread_mutex_unlock(&queue->lock);
+    return status;
+}
+
+size_t bqDrainTo(BlockingQueue* queue, void** out, size_t max, long timeoutMs) {
+    if (queue == NULL || out == NULL) {
+        fprintf(stderr, "Error: BlockingQueue or output is NULL\n");
+        return 0;
+    }
+    if (max == 0) return 0;
+    pthread_mutex_lock(&queue->lock);
+    size_t count = 0;
+    if (waitForItems(queue, timeoutMs)) {
+        while (count < max && queue->items->size > 0) {
+            out[count++] = popFront(queue->items);
+        }
+    }
+    pthread_mutex_unlock(&queue->lock);
+    return count;
+}
+
+void bqClose(BlockingQueue* queue) {
+    if (queue == NULL) {
+        fprintf(stderr, "Error: BlockingQueue is NULL\n");
+        return;
+    }
+    pthread_mutex_lock(&queue->lock);
+    queue->closed = true;
+    pthread_cond_broadcast(&queue->notEmpty);
+    pthread_mutex_unlock(&queue->lock);
+}
+
+void freeBlockingQueue(BlockingQueue* queue) {
+    if (queue == NULL) return;
+    freeDeque(queue->items);
+    pthread_cond_destroy(&queue->notEmpty);
+    pthread_mutex_destroy(&queue->lock);
+    delete(queue);
+}
@@ -5,6 +5,37 @@
 #include <stdbool.h>
 #include <assert.h>
 
+#define DEFAULT_DEQUE_CAPACITY 16
+
+// Storage is a ring whose capacity is a power of two, so wrapping an index
+// is a mask and every end operation is O(1) amortized.
+#define SLOT(queue, i) ((queue)->data[((queue)->head + (i)) & ((queue)->capacity - 1)])
+
+static bool reserveDeque(Deque* queue, uint needed) {
+    if (needed <= queue->capacity) return true;
+    uint newCapacity = queue->capacity;
+    while (newCapacity < needed) newCapacity *= 2;
+    void** resized = (void**)malloc(newCapacity * sizeof(void*));
+    if (resized == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed while growing deque\n");
+        return false;
+    }
+    // Unwrap into the new buffer so the front lands at index 0.
+    uint firstPart = queue->capacity - queue->head;
+    if (firstPart > queue->size) firstPart = queue->size;
+    memcpy(resized, queue->data + queue->head, firstPart * sizeof(void*));
+    memcpy(resized + firstPart, queue->data, (queue->size - firstPart) * sizeof(void*));
+    free(queue->data);
+    queue->data = resized;
+    queue->capacity = newCapacity;
+    queue->head = 0;
+    return true;
+}
+
+static bool growDeque(Deque* queue) {
+    return reserveDeque(queue, queue->size + 1);
+}
+
 // ===================================================
 //                . . . DEQUE . . .
 // ===================================================
@@ -17,8 +48,14 @@ Deque* createDeque(void) {
         fprintf(stderr, "Error: Memory allocation failed for Deque\n");
         return NULL;
     }
-    queue->Front = NULL;
-    queue->Rear = NULL;
+    queue->data = (void**)malloc(DEFAULT_DEQUE_CAPACITY * sizeof(void*));
+    if (queue->data == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed for Deque storage\n");
+        delete(queue);
+        return NULL;
+    }
+    queue->capacity = DEFAULT_DEQUE_CAPACITY;
+    queue->head = 0;
     queue->size = 0;
     return queue;
 }
@@ -31,7 +68,7 @@ bool isDequeEmpty(Deque* queue) {
         fprintf(stderr, "Error: Deque is NULL\n");
         return true;
     }
-    return (queue->Front == NULL && queue->Rear == NULL);
+    return (queue->size == 0);
 }
 
 uint getDequeSize(Deque* queue) {
@@ -54,7 +91,7 @@ void* Deque_peekFront(Deque* queue) {
         fprintf(stderr, "Error: Deque is empty\n");
         return NULL;
     }
-    return queue->Front->data;
+    return SLOT(queue, 0);
 }
 
 void* Deque_peekBack(Deque* queue) {
@@ -66,7 +103,19 @@ void* Deque_peekBack(Deque* queue) {
         fprintf(stderr, "Error: Deque is empty\n");
         return NULL;
     }
-    return queue->Rear->data;
+    return SLOT(queue, queue->size - 1);
+}
+
+void* Deque_at(Deque* queue, uint index) {
+    if (queue == NULL) {
+        fprintf(stderr, "Error: Deque is NULL\n");
+        return NULL;
+    }
+    if (index >= queue->size) {
+        fprintf(stderr, "Error: Invalid position for retrieval\n");
+        return NULL;
+    }
+    return SLOT(queue, index);
 }
 
 
@@ -77,21 +126,9 @@ void pushBack(Deque* queue, void* data) {
         fprintf(stderr, "Error: Deque is NULL\n");
         return;
     }
-    SLLNode* newNode = createSLLNode(data);
-    if (newNode == NULL) {
-        fprintf(stderr, "Error: Memory allocation failed for new node\n");
-        return;
-    }
-    if (isDequeEmpty(queue)) {
-        queue->Front = newNode;
-        queue->Rear = newNode;
-    }
-    else {
-        queue->Rear->next = newNode;
-        queue->Rear = newNode;
-    }
+    if (!growDeque(queue)) return;
+    SLOT(queue, queue->size) = data;
     queue->size++;
-    newNode->next = NULL;
 }
 
 void pushFront(Deque* queue, void* data) {
@@ -99,19 +136,9 @@ void pushFront(Deque* queue, void* data) {
         fprintf(stderr, "Error: Deque is NULL\n");
         return;
     }
-    SLLNode* newNode = createSLLNode(data);
-    if (newNode == NULL) {
-        fprintf(stderr, "Error: Memory allocation failed for new node\n");
-        return;
-    }
-    if (isDequeEmpty(queue)) {
-        queue->Front = newNode;
-        queue->Rear = newNode;
-    }
-    else {
-        newNode->next = queue->Front;
-        queue->Front = newNode;
-    }
+    if (!growDeque(queue)) return;
+    queue->head = (queue->head - 1) & (queue->capacity - 1);
+    queue->data[queue->head] = data;
     queue->size++;
 }
 
@@ -124,23 +151,8 @@ void* popBack(Deque* queue) {
         fprintf(stderr, "Error: Deque is empty\n");
         return NULL;
     }
-    SLLNode* rearNode = queue->Rear;
-    void* data = rearNode->data;
-    if (queue->Front == queue->Rear) {
-        queue->Front = NULL;
-        queue->Rear = NULL;
-    }
-    else {
-        SLLNode* current = queue->Front;
-        while (current->next != queue->Rear) {
-            current = current->next;
-        }
-        current->next = NULL;
-        queue->Rear = current;
-    }
-    delete(rearNode);
     queue->size--;
-    return data;
+    return SLOT(queue, queue->size);
 }
 
 void* popFront(Deque* queue) {
@@ -152,17 +164,43 @@ void* popFront(Deque* queue) {
         fprintf(stderr, "Error: Deque is empty\n");
         return NULL;
     }
-    SLLNode* frontNode = queue->Front;
-    void* data = frontNode->data;
-    queue->Front = frontNode->next;
-    if (queue->Front == NULL) {
-        queue->Rear = NULL;
-    }
-    delete(frontNode);
+    void* data = queue->data[queue->head];
+    queue->head = (queue->head + 1) & (queue->capacity - 1);
     queue->size--;
     return data;
 }
 
+uint pushBackMany(Deque* queue, void** items, uint count) {
+    if (queue == NULL || items == NULL) {
+        fprintf(stderr, "Error: Deque or items array is NULL\n");
+        return 0;
+    }
+    if (!reserveDeque(queue, queue->size + count)) return 0;
+    // At most two contiguous spans: up to the end of the buffer, then from 0.
+    uint tail = (queue->head + queue->size) & (queue->capacity - 1);
+    uint firstPart = queue->capacity - tail;
+    if (firstPart > count) firstPart = count;
+    memcpy(queue->data + tail, items, firstPart * sizeof(void*));
+    memcpy(queue->data, items + firstPart, (count - firstPart) * sizeof(void*));
+    queue->size += count;
+    return count;
+}
+
+uint dequeDrainTo(Deque* queue, void** out, uint max) {
+    if (queue == NULL || out == NULL) {
+        fprintf(stderr, "Error: Deque or output array is NULL\n");
+        return 0;
+    }
+    uint count = max < queue->size ? max : queue->size;
+    uint firstPart = queue->capacity - queue->head;
+    if (firstPart > count) firstPart = count;
+    memcpy(out, queue->data + queue->head, firstPart * sizeof(void*));
+    memcpy(out + firstPart, queue->data, (count - firstPart) * sizeof(void*));
+    queue->head = (queue->head + count) & (queue->capacity - 1);
+    queue->size -= count;
+    return count;
+}
+
 
 /*  DEALOC AND DESTRUCT
  * ==================== */
@@ -171,11 +209,7 @@ void clearDeque(Deque* queue) {
         fprintf(stderr, "Error: Deque is NULL\n");
         return;
     }
-    while (!isDequeEmpty(queue)) {
-        popFront(queue);
-    }
-    queue->Front = NULL;
-    queue->Rear = NULL;
+    queue->head = 0;
     queue->size = 0;
 }
 
@@ -184,7 +218,7 @@ void freeDeque(Deque* queue) {
         fprintf(stderr, "Error: Deque is NULL\n");
         return;
     }
-    clearDeque(queue);
+    free(queue->data);
     delete(queue);
 }
 
@@ -196,10 +230,8 @@ void printDeque(Deque* queue, void (*printFunc)(void*)) {
         fprintf(stderr, "Error: Deque is NULL\n");
         return;
     }
-    SLLNode* current = queue->Front;
-    while (current != NULL) {
-        printFunc(current->data);
-        current = current->next;
+    for (uint i = 0; i < queue->size; i++) {
+        printFunc(SLOT(queue, i));
     }
 }
 
@@ -208,18 +240,7 @@ void printDequeReverse(Deque* queue, void (*printFunc)(void*)) {
         fprintf(stderr, "Error: Deque is NULL\n");
         return;
     }
-    if (queue->size == 0) return;
-    SLLNode** stack = (SLLNode**)malloc(queue->size * sizeof(SLLNode*));
-    if (stack == NULL) {
-        fprintf(stderr, "Error: Memory allocation failed for reverse print\n");
-        return;
-    }
-    uint idx = 0;
-    for (SLLNode* cur = queue->Front; cur != NULL; cur = cur->next) {
-        stack[idx++] = cur;
-    }
-    while (idx > 0) {
-        printFunc(stack[--idx]->data);
+    for (uint i = queue->size; i > 0; i--) {
+        printFunc(SLOT(queue, i - 1));
     }
-    free(stack);
 }
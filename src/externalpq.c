@@ -0,0 +1,394 @@
+#include "externalpq.h"
+#include <string.h>
+
+#define IO_BLOCK_BYTES (64 * 1024)
+
+static void* runCurrent(const EPQRun* run) {
+    return run->block + run->pos * run->owner->recordSize;
+}
+
+static int runCompare(const void* a, const void* b) {
+    const EPQRun* ra = (const EPQRun*)a;
+    const EPQRun* rb = (const EPQRun*)b;
+    return ra->owner->cmp(runCurrent(ra), runCurrent(rb));
+}
+
+// Read the next block; false on a short read (only the records actually
+// read are counted as consumed).
+static bool loadBlock(EPQRun* run) {
+    size_t want = run->remaining < run->owner->blockRecords ? run->remaining : run->owner->blockRecords;
+    run->pos = 0;
+    run->len = 0;
+    if (fgetpos(run->file, &run->blockStart) != 0) {
+        fprintf(stderr, "Error: Failed to read spilled run position\n");
+        return false;
+    }
+    size_t got = fread(run->block, run->owner->recordSize, want, run->file);
+    run->remaining -= got;
+    run->len = got;
+    if (got != want) {
+        fprintf(stderr, "Error: Failed to read spilled run\n");
+        return false;
+    }
+    return got > 0;
+}
+
+static void freeRun(EPQRun* run) {
+    if (run == NULL) return;
+    if (run->file != NULL) fclose(run->file);
+    free(run->block);
+    delete(run);
+}
+
+// Step past the current record; false once the run is exhausted. Records
+// lost to a read error are dropped from the queue size so it stays exact.
+static bool advanceRun(EPQRun* run) {
+    run->pos++;
+    if (run->pos < run->len) return true;
+    if (run->remaining == 0) return false;
+    size_t before = run->remaining;
+    if (!loadBlock(run)) {
+        run->owner->size -= before - run->len;
+        run->remaining = 0;
+    }
+    return run->len > 0;
+}
+
+/** Read state of a run, enough to put it back after a failed merge. */
+typedef struct RunMark {
+    fpos_t blockStart;
+    size_t remaining;
+    size_t len;
+    size_t pos;
+} RunMark;
+
+// Reload the block the run was on when marked. fsetpos restores the
+// opaque position saved by loadBlock, so no offset arithmetic is needed.
+static bool restoreRun(EPQRun* run, const RunMark* mark) {
+    if (fsetpos(run->file, &mark->blockStart) != 0) return false;
+    run->remaining = mark->remaining + mark->len;
+    if (!loadBlock(run) || run->len != mark->len) return false;
+    run->pos = mark->pos;
+    return true;
+}
+
+static EPQRun* createRun(ExternalPQ* pq) {
+    EPQRun* run = new(EPQRun);
+    if (run == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed for EPQRun\n");
+        return NULL;
+    }
+    run->owner = pq;
+    run->level = 0;
+    run->remaining = 0;
+    run->pos = 0;
+    run->len = 0;
+    run->block = (char*)malloc(pq->blockRecords * pq->recordSize);
+    run->file = tmpfile();
+    if (run->block == NULL || run->file == NULL) {
+        fprintf(stderr, "Error: Failed to create spill run\n");
+        freeRun(run);
+        return NULL;
+    }
+    return run;
+}
+
+static size_t runsAtLevel(ExternalPQ* pq, unsigned int level) {
+    size_t count = 0;
+    for (size_t i = 0; i < pq->runs->size; i++) {
+        if (((EPQRun*)pq->runs->data[i])->level == level) count++;
+    }
+    return count;
+}
+
+// Multiway-merge every run of one level into a single run of the next
+// level. Source runs are only closed once the merged run is on disk; on
+// failure each is put back on the block and record it was on.
+static bool mergeLevel(ExternalPQ* pq, unsigned int level) {
+    size_t all = pq->runs->size;
+    size_t count = runsAtLevel(pq, level);
+    EPQRun** runs = (EPQRun**)malloc(all * sizeof(EPQRun*));
+    RunMark* marks = (RunMark*)malloc(count * sizeof(RunMark));
+    Heap* merging = createHeapWithCapacity(runCompare, count);
+    EPQRun* merged = (runs != NULL && marks != NULL && merging != NULL) ? createRun(pq) : NULL;
+    if (merged == NULL) {
+        fprintf(stderr, "Error: Failed to start run merge\n");
+        free(runs);
+        free(marks);
+        freeHeap(merging);
+        return false;
+    }
+    merged->level = level + 1;
+
+    // Sources first, the runs staying on the queue after them.
+    size_t front = 0;
+    size_t back = count;
+    for (size_t i = 0; i < all; i++) {
+        EPQRun* run = (EPQRun*)pq->runs->data[i];
+        if (run->level == level) runs[front++] = run;
+        else runs[back++] = run;
+    }
+    size_t total = 0;
+    for (size_t i = 0; i < count; i++) {
+        EPQRun* run = runs[i];
+        marks[i].blockStart = run->blockStart;
+        marks[i].remaining = run->remaining;
+        marks[i].len = run->len;
+        marks[i].pos = run->pos;
+        total += run->remaining + run->len - run->pos;
+        heapPush(merging, run);
+    }
+    pq->runs->size = 0;
+    for (size_t i = count; i < all; i++) heapPush(pq->runs, runs[i]);
+
+    bool ok = true;
+    size_t staged = 0;
+    while (ok && merging->size > 0) {
+        EPQRun* run = (EPQRun*)merging->data[0];
+        memcpy(pq->writeBlock + staged * pq->recordSize, runCurrent(run), pq->recordSize);
+        if (++staged == pq->blockRecords) {
+            if (fwrite(pq->writeBlock, pq->recordSize, staged, merged->file) != staged) ok = false;
+            staged = 0;
+        }
+        run->pos++;
+        if (run->pos < run->len) {
+            heapReplaceTop(merging, run);
+        } else if (run->remaining == 0) {
+            heapPop(merging);
+        } else if (loadBlock(run)) {
+            heapReplaceTop(merging, run);
+        } else {
+            ok = false;
+        }
+    }
+    if (ok && staged > 0 && fwrite(pq->writeBlock, pq->recordSize, staged, merged->file) != staged) ok = false;
+    if (ok && fflush(merged->file) != 0) ok = false;
+    if (ok) {
+        rewind(merged->file);
+        merged->remaining = total;
+        ok = loadBlock(merged);
+    }
+
+    if (ok) {
+        for (size_t i = 0; i < count; i++) freeRun(runs[i]);
+        heapPush(pq->runs, merged);
+    } else {
+        fprintf(stderr, "Error: Failed to merge spilled runs\n");
+        for (size_t i = 0; i < count; i++) {
+            if (restoreRun(runs[i], &marks[i])) {
+                heapPush(pq->runs, runs[i]);
+            } else {
+                pq->size -= marks[i].remaining + marks[i].len - marks[i].pos;
+                freeRun(runs[i]);
+            }
+        }
+        freeRun(merged);
+    }
+    free(runs);
+    free(marks);
+    freeHeap(merging);
+    return ok;
+}
+
+// Tiered merging: once a level holds EPQ_MERGE_FANIN runs they become one
+// run of the next level, so each record is rewritten once per level, i.e.
+// O(log_fanin(spills)) times. A failed merge leaves the runs as they were.
+static void mergeFullLevels(ExternalPQ* pq) {
+    for (unsigned int level = 0; runsAtLevel(pq, level) >= EPQ_MERGE_FANIN; level++) {
+        if (!mergeLevel(pq, level)) return;
+    }
+}
+
+static void resetSlots(ExternalPQ* pq) {
+    for (size_t i = 0; i < pq->bufferCapacity; i++) {
+        pq->freeSlots[i] = pq->records + i * pq->recordSize;
+    }
+    pq->freeCount = pq->bufferCapacity;
+}
+
+// Put popped buffer pointers back; an ascending array is already a valid heap.
+static void restoreBuffer(ExternalPQ* pq, size_t count) {
+    memcpy(pq->buffer->data, pq->freeSlots, count * sizeof(void*));
+    pq->buffer->size = count;
+}
+
+// Write the in-memory buffer out as one sorted level-0 run, in block-sized writes.
+// Spills happen only when no slot is free, so freeSlots serves as scratch
+// for the sorted order. The buffer is released only once the run is on
+// disk and readable; on any failure it is restored untouched.
+static bool spill(ExternalPQ* pq) {
+    EPQRun* run = createRun(pq);
+    if (run == NULL) return false;
+
+    size_t count = pq->buffer->size;
+    for (size_t i = 0; i < count; i++) pq->freeSlots[i] = heapPop(pq->buffer);
+    bool ok = true;
+    for (size_t i = 0; i < count && ok; i += pq->blockRecords) {
+        size_t staged = count - i < pq->blockRecords ? count - i : pq->blockRecords;
+        for (size_t j = 0; j < staged; j++) {
+            memcpy(pq->writeBlock + j * pq->recordSize, pq->freeSlots[i + j], pq->recordSize);
+        }
+        if (fwrite(pq->writeBlock, pq->recordSize, staged, run->file) != staged) ok = false;
+    }
+    if (!ok || fflush(run->file) != 0) {
+        fprintf(stderr, "Error: Failed to write spilled run\n");
+        ok = false;
+    }
+    if (ok) {
+        rewind(run->file);
+        run->remaining = count;
+        ok = loadBlock(run) && heapPush(pq->runs, run);
+    }
+    if (!ok) {
+        restoreBuffer(pq, count);
+        freeRun(run);
+        return false;
+    }
+    resetSlots(pq);
+    mergeFullLevels(pq);
+    return true;
+}
+
+// Pick where the smallest record lives: in-memory top or the best run.
+static void* smallest(ExternalPQ* pq, EPQRun** fromRun) {
+    void* best = NULL;
+    *fromRun = NULL;
+    if (pq->buffer->size > 0) best = pq->buffer->data[0];
+    if (pq->runs->size > 0) {
+        EPQRun* run = (EPQRun*)pq->runs->data[0];
+        void* head = runCurrent(run);
+        if (best == NULL || pq->cmp(head, best) < 0) {
+            best = head;
+            *fromRun = run;
+        }
+    }
+    return best;
+}
+
+ExternalPQ* createExternalPQ(size_t recordSize, size_t memoryBudget, HeapCompare cmp) {
+    if (recordSize == 0 || cmp == NULL) {
+        fprintf(stderr, "Error: Record size must be positive and comparator non-NULL\n");
+        return NULL;
+    }
+    ExternalPQ* pq = new(ExternalPQ);
+    if (pq == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed for ExternalPQ\n");
+        return NULL;
+    }
+    // Each buffered record costs its bytes plus a heap pointer and a free-slot pointer.
+    size_t perRecord = recordSize + 2 * sizeof(void*);
+    pq->recordSize = recordSize;
+    pq->bufferCapacity = memoryBudget / perRecord;
+    if (pq->bufferCapacity == 0) pq->bufferCapacity = 1;
+    pq->blockRecords = IO_BLOCK_BYTES / recordSize;
+    if (pq->blockRecords == 0) pq->blockRecords = 1;
+    pq->size = 0;
+    pq->cmp = cmp;
+    pq->records = (char*)malloc(pq->bufferCapacity * recordSize);
+    pq->freeSlots = (void**)malloc(pq->bufferCapacity * sizeof(void*));
+    pq->writeBlock = (char*)malloc(pq->blockRecords * recordSize);
+    pq->buffer = createHeapWithCapacity(cmp, pq->bufferCapacity);
+    pq->runs = createHeap(runCompare);
+    if (pq->records == NULL || pq->freeSlots == NULL || pq->writeBlock == NULL ||
+        pq->buffer == NULL || pq->runs == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed for ExternalPQ storage\n");
+        freeExternalPQ(pq);
+        return NULL;
+    }
+    resetSlots(pq);
+    return pq;
+}
+
+bool epqIsEmpty(ExternalPQ* pq) {
+    if (pq == NULL) {
+        fprintf(stderr, "Error: ExternalPQ is NULL\n");
+        return true;
+    }
+    return pq->size == 0;
+}
+
+size_t epqSize(ExternalPQ* pq) {
+    if (pq == NULL) {
+        fprintf(stderr, "Error: ExternalPQ is NULL\n");
+        return 0;
+    }
+    return pq->size;
+}
+
+size_t epqRunCount(ExternalPQ* pq) {
+    if (pq == NULL) {
+        fprintf(stderr, "Error: ExternalPQ is NULL\n");
+        return 0;
+    }
+    return pq->runs->size;
+}
+
+bool epqPush(ExternalPQ* pq, const void* record) {
+    if (pq == NULL || record == NULL) {
+        fprintf(stderr, "Error: ExternalPQ or record is NULL\n");
+        return false;
+    }
+    if (pq->freeCount == 0 && !spill(pq)) return false;
+    void* slot = pq->freeSlots[--pq->freeCount];
+    memcpy(slot, record, pq->recordSize);
+    heapPush(pq->buffer, slot);
+    pq->size++;
+    return true;
+}
+
+bool epqPop(ExternalPQ* pq, void* out) {
+    if (pq == NULL || out == NULL) {
+        fprintf(stderr, "Error: ExternalPQ or output is NULL\n");
+        return false;
+    }
+    if (pq->size == 0) {
+        fprintf(stderr, "Error: ExternalPQ is empty\n");
+        return false;
+    }
+    EPQRun* run = NULL;
+    void* best = smallest(pq, &run);
+    if (best == NULL) return false;
+    memcpy(out, best, pq->recordSize);
+    if (run != NULL) {
+        if (advanceRun(run)) {
+            heapReplaceTop(pq->runs, run);
+        } else {
+            freeRun((EPQRun*)heapPop(pq->runs));
+        }
+    } else {
+        pq->freeSlots[pq->freeCount++] = heapPop(pq->buffer);
+    }
+    pq->size--;
+    return true;
+}
+
+bool epqPeek(ExternalPQ* pq, void* out) {
+    if (pq == NULL || out == NULL) {
+        fprintf(stderr, "Error: ExternalPQ or output is NULL\n");
+        return false;
+    }
+    if (pq->size == 0) {
+        fprintf(stderr, "Error: ExternalPQ is empty\n");
+        return false;
+    }
+    EPQRun* run = NULL;
+    void* best = smallest(pq, &run);
+    if (best == NULL) return false;
+    memcpy(out, best, pq->recordSize);
+    return true;
+}
+
+void freeExternalPQ(ExternalPQ* pq) {
+    if (pq == NULL) return;
+    if (pq->runs != NULL) {
+        for (size_t i = 0; i < pq->runs->size; i++) {
+            freeRun((EPQRun*)pq->runs->data[i]);
+        }
+        freeHeap(pq->runs);
+    }
+    freeHeap(pq->buffer);
+    free(pq->records);
+    free(pq->freeSlots);
+    free(pq->writeBlock);
+    delete(pq);
+}
@@ -133,6 +133,21 @@ void* heapPeek(Heap* heap) {
     return heap->data[0];
 }
 
+void* heapReplaceTop(Heap* heap, void* item) {
+    if (heap == NULL) {
+        fprintf(stderr, "Error: Heap is NULL\n");
+        return NULL;
+    }
+    if (heap->size == 0) {
+        fprintf(stderr, "Error: Heap is empty\n");
+        return NULL;
+    }
+    void* top = heap->data[0];
+    heap->data[0] = item;
+    siftDown(heap, 0);
+    return top;
+}
+
 void clearHeap(Heap* heap) {
     if (heap == NULL) {
         fprintf(stderr, "Error: Heap is NULL\n");
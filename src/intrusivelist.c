@@ -0,0 +1,136 @@
+#include "intrusivelist.h"
+#include <stdio.h>
+
+/*      CONSTRUCTOR
+ * ==================== */
+IntrusiveList* createIntrusiveList(void) {
+    IntrusiveList* list = new(IntrusiveList);
+    if (list == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed for IntrusiveList\n");
+        return NULL;
+    }
+    IL_initList(list);
+    return list;
+}
+
+void IL_initList(IntrusiveList* list) {
+    if (list == NULL) {
+        fprintf(stderr, "Error: List is NULL\n");
+        return;
+    }
+    list->head = NULL;
+    list->tail = NULL;
+    list->size = 0;
+}
+
+void IL_initLink(ListLink* link) {
+    if (link == NULL) {
+        fprintf(stderr, "Error: ListLink is NULL\n");
+        return;
+    }
+    link->next = link;
+    link->prev = link;
+}
+
+bool IL_isLinked(ListLink* link) {
+    return link != NULL && link->next != link;
+}
+
+/*     INSERT NODE
+ * ==================== */
+void IL_insertFront(IntrusiveList* list, ListLink* link) {
+    if (list == NULL || link == NULL) {
+        fprintf(stderr, "Error: List or link is NULL\n");
+        return;
+    }
+    link->prev = NULL;
+    link->next = list->head;
+    if (list->head != NULL) list->head->prev = link;
+    else list->tail = link;
+    list->head = link;
+    list->size++;
+}
+
+void IL_insertBack(IntrusiveList* list, ListLink* link) {
+    if (list == NULL || link == NULL) {
+        fprintf(stderr, "Error: List or link is NULL\n");
+        return;
+    }
+    link->next = NULL;
+    link->prev = list->tail;
+    if (list->tail != NULL) list->tail->next = link;
+    else list->head = link;
+    list->tail = link;
+    list->size++;
+}
+
+void IL_insertAfter(IntrusiveList* list, ListLink* pos, ListLink* link) {
+    if (list == NULL || pos == NULL || link == NULL) {
+        fprintf(stderr, "Error: List or link is NULL\n");
+        return;
+    }
+    link->prev = pos;
+    link->next = pos->next;
+    if (pos->next != NULL) pos->next->prev = link;
+    else list->tail = link;
+    pos->next = link;
+    list->size++;
+}
+
+/*     REMOVE NODE
+ * ==================== */
+void IL_removeNode(IntrusiveList* list, ListLink* link) {
+    if (list == NULL || link == NULL) {
+        fprintf(stderr, "Error: List or link is NULL\n");
+        return;
+    }
+    if (!IL_isLinked(link)) {
+        fprintf(stderr, "Error: ListLink is not linked\n");
+        return;
+    }
+    if (link->prev != NULL) link->prev->next = link->next;
+    else list->head = link->next;
+    if (link->next != NULL) link->next->prev = link->prev;
+    else list->tail = link->prev;
+    IL_initLink(link);
+    list->size--;
+}
+
+ListLink* IL_popFront(IntrusiveList* list) {
+    if (list == NULL || list->head == NULL) return NULL;
+    ListLink* link = list->head;
+    IL_removeNode(list, link);
+    return link;
+}
+
+ListLink* IL_popBack(IntrusiveList* list) {
+    if (list == NULL || list->tail == NULL) return NULL;
+    ListLink* link = list->tail;
+    IL_removeNode(list, link);
+    return link;
+}
+
+/*  DEALOC AND DESTRUCT
+ * ==================== */
+void IL_clearList(IntrusiveList* list) {
+    if (list == NULL) {
+        fprintf(stderr, "Error: List is NULL\n");
+        return;
+    }
+    ListLink* current = list->head;
+    while (current != NULL) {
+        ListLink* next = current->next;
+        IL_initLink(current);
+        current = next;
+    }
+    IL_initList(list);
+}
+
+void IL_freeList(IntrusiveList* list) {
+    if (list == NULL) {
+        fprintf(stderr, "Error: List is NULL\n");
+        return;
+    }
+    IL_clearList(list);
+    delete(list);
+}
@@ -0,0 +1,294 @@
+#include "lfsortedlist.h"
+#include <stdio.h>
+
+#define MARK ((uintptr_t)1)
+#define IS_MARKED(word) (((word) & MARK) != 0)
+#define NODE_OF(word) ((LFSLNode*)((word) & ~MARK))
+
+static atomic_uint_fast64_t nextListId = 1;
+
+// Any address unique to a live thread identifies it; a new thread that
+// inherits the address of an exited one simply adopts its record.
+static RST_THREAD_LOCAL char threadToken;
+static RST_THREAD_LOCAL struct {
+    LockFreeSortedList* list;
+    uint64_t id;
+    LFSLParticipant* participant;
+} threadCache;
+
+static void reclaimChain(LockFreeSortedList* list, LFSLNode* node) {
+    while (node != NULL) {
+        LFSLNode* next = node->retiredNext;
+        if (list->freeKey != NULL) list->freeKey(node->key);
+        free(node);
+        node = next;
+    }
+}
+
+static LFSLParticipant* joinList(LockFreeSortedList* list) {
+    if (threadCache.list == list && threadCache.id == list->id) return threadCache.participant;
+    LFSLParticipant* found = NULL;
+    for (int i = 0; i < LFSL_MAX_THREADS && found == NULL; i++) {
+        if (atomic_load_explicit(&list->participants[i].owner, memory_order_acquire) == &threadToken) {
+            found = &list->participants[i];
+        }
+    }
+    for (int i = 0; i < LFSL_MAX_THREADS && found == NULL; i++) {
+        void* expected = NULL;
+        if (atomic_compare_exchange_strong_explicit(&list->participants[i].owner, &expected, &threadToken,
+                                                    memory_order_acq_rel, memory_order_relaxed)) {
+            found = &list->participants[i];
+        }
+    }
+    if (found == NULL) {
+        fprintf(stderr, "Error: LockFreeSortedList thread limit reached\n");
+        return NULL;
+    }
+    threadCache.list = list;
+    threadCache.id = list->id;
+    threadCache.participant = found;
+    return found;
+}
+
+// Advance the global epoch if every active thread has observed it.
+static void tryAdvance(LockFreeSortedList* list) {
+    unsigned int epoch = atomic_load_explicit(&list->epoch, memory_order_seq_cst);
+    for (int i = 0; i < LFSL_MAX_THREADS; i++) {
+        unsigned int state = atomic_load_explicit(&list->participants[i].state, memory_order_seq_cst);
+        if ((state & 1) != 0 && (state >> 1) != epoch) return;
+    }
+    atomic_compare_exchange_strong_explicit(&list->epoch, &epoch, epoch + 1,
+                                            memory_order_seq_cst, memory_order_relaxed);
+}
+
+static LFSLParticipant* enterOp(LockFreeSortedList* list) {
+    LFSLParticipant* self = joinList(list);
+    if (self == NULL) return NULL;
+    unsigned int epoch = atomic_load_explicit(&list->epoch, memory_order_relaxed);
+    atomic_store_explicit(&self->state, (epoch << 1) | 1, memory_order_seq_cst);
+    // Re-read after publishing so the epoch we announce is not stale.
+    epoch = atomic_load_explicit(&list->epoch, memory_order_seq_cst);
+    atomic_store_explicit(&self->state, (epoch << 1) | 1, memory_order_seq_cst);
+    if (epoch != self->localEpoch) {
+        // This bucket holds nodes retired at least three epochs ago.
+        LFSLNode* expired = self->limbo[epoch % 3];
+        self->limbo[epoch % 3] = NULL;
+        self->localEpoch = epoch;
+        reclaimChain(list, expired);
+    }
+    return self;
+}
+
+static void exitOp(LFSLParticipant* self) {
+    atomic_store_explicit(&self->state, 0, memory_order_release);
+}
+
+static void retireNode(LockFreeSortedList* list, LFSLParticipant* self, LFSLNode* node) {
+    node->retiredNext = self->limbo[self->localEpoch % 3];
+    self->limbo[self->localEpoch % 3] = node;
+    if (++self->retired >= LFSL_RETIRE_THRESHOLD) {
+        self->retired = 0;
+        tryAdvance(list);
+    }
+}
+
+// Position *prevOut/*currOut around key, unlinking marked nodes on the way.
+static bool findKey(LockFreeSortedList* list, LFSLParticipant* self, const void* key,
+                    _Atomic(uintptr_t)** prevOut, LFSLNode** currOut) {
+retry:;
+    _Atomic(uintptr_t)* prev = &list->head.next;
+    LFSLNode* curr = NODE_OF(atomic_load_explicit(prev, memory_order_acquire));
+    while (curr != NULL) {
+        uintptr_t next = atomic_load_explicit(&curr->next, memory_order_acquire);
+        if (IS_MARKED(next)) {
+            uintptr_t expected = (uintptr_t)curr;
+            if (!atomic_compare_exchange_strong_explicit(prev, &expected, next & ~MARK,
+                                                         memory_order_acq_rel, memory_order_acquire)) {
+                goto retry;
+            }
+            retireNode(list, self, curr);
+            curr = NODE_OF(next);
+            continue;
+        }
+        int c = list->cmp(curr->key, key);
+        if (c >= 0) {
+            *prevOut = prev;
+            *currOut = curr;
+            return c == 0;
+        }
+        prev = &curr->next;
+        curr = NODE_OF(next);
+    }
+    *prevOut = prev;
+    *currOut = NULL;
+    return false;
+}
+
+LockFreeSortedList* createLockFreeSortedList(ListCompare cmp, void (*freeKey)(void*)) {
+    if (cmp == NULL) {
+        fprintf(stderr, "Error: Comparator is NULL\n");
+        return NULL;
+    }
+    LockFreeSortedList* list = new(LockFreeSortedList);
+    if (list == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed for LockFreeSortedList\n");
+        return NULL;
+    }
+    list->head.key = NULL;
+    atomic_init(&list->head.next, (uintptr_t)0);
+    list->head.retiredNext = NULL;
+    list->cmp = cmp;
+    list->freeKey = freeKey;
+    list->id = atomic_fetch_add(&nextListId, 1);
+    atomic_init(&list->size, 0);
+    atomic_init(&list->epoch, 0);
+    atomic_init(&list->orphans, NULL);
+    for (int i = 0; i < LFSL_MAX_THREADS; i++) {
+        LFSLParticipant* p = &list->participants[i];
+        atomic_init(&p->owner, NULL);
+        atomic_init(&p->state, 0);
+        p->localEpoch = 0;
+        p->limbo[0] = p->limbo[1] = p->limbo[2] = NULL;
+        p->retired = 0;
+    }
+    return list;
+}
+
+bool lfslInsert(LockFreeSortedList* list, void* key) {
+    if (list == NULL) {
+        fprintf(stderr, "Error: LockFreeSortedList is NULL\n");
+        return false;
+    }
+    LFSLNode* node = new(LFSLNode);
+    if (node == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed for LFSLNode\n");
+        return false;
+    }
+    node->key = key;
+    node->retiredNext = NULL;
+    LFSLParticipant* self = enterOp(list);
+    if (self == NULL) {
+        delete(node);
+        return false;
+    }
+    for (;;) {
+        _Atomic(uintptr_t)* prev;
+        LFSLNode* curr;
+        if (findKey(list, self, key, &prev, &curr)) {
+            exitOp(self);
+            delete(node);
+            return false;
+        }
+        atomic_store_explicit(&node->next, (uintptr_t)curr, memory_order_relaxed);
+        uintptr_t expected = (uintptr_t)curr;
+        if (atomic_compare_exchange_strong_explicit(prev, &expected, (uintptr_t)node,
+                                                    memory_order_release, memory_order_relaxed)) {
+            atomic_fetch_add_explicit(&list->size, 1, memory_order_relaxed);
+            exitOp(self);
+            return true;
+        }
+    }
+}
+
+bool lfslRemove(LockFreeSortedList* list, const void* key) {
+    if (list == NULL) {
+        fprintf(stderr, "Error: LockFreeSortedList is NULL\n");
+        return false;
+    }
+    LFSLParticipant* self = enterOp(list);
+    if (self == NULL) return false;
+    for (;;) {
+        _Atomic(uintptr_t)* prev;
+        LFSLNode* curr;
+        if (!findKey(list, self, key, &prev, &curr)) {
+            exitOp(self);
+            return false;
+        }
+        uintptr_t next = atomic_load_explicit(&curr->next, memory_order_acquire);
+        if (IS_MARKED(next)) continue;
+        // Logical delete: whoever sets the mark owns the removal.
+        if (!atomic_compare_exchange_strong_explicit(&curr->next, &next, next | MARK,
+                                                     memory_order_acq_rel, memory_order_relaxed)) {
+            continue;
+        }
+        atomic_fetch_sub_explicit(&list->size, 1, memory_order_relaxed);
+        uintptr_t expected = (uintptr_t)curr;
+        if (atomic_compare_exchange_strong_explicit(prev, &expected, next,
+                                                    memory_order_acq_rel, memory_order_relaxed)) {
+            retireNode(list, self, curr);
+        }
+        else {
+            findKey(list, self, key, &prev, &curr);  // Let a traversal unlink it.
+        }
+        exitOp(self);
+        return true;
+    }
+}
+
+bool lfslContains(LockFreeSortedList* list, const void* key) {
+    if (list == NULL) {
+        fprintf(stderr, "Error: LockFreeSortedList is NULL\n");
+        return false;
+    }
+    LFSLParticipant* self = enterOp(list);
+    if (self == NULL) return false;
+    LFSLNode* curr = NODE_OF(atomic_load_explicit(&list->head.next, memory_order_acquire));
+    while (curr != NULL && list->cmp(curr->key, key) < 0) {
+        curr = NODE_OF(atomic_load_explicit(&curr->next, memory_order_acquire));
+    }
+    bool found = curr != NULL && list->cmp(curr->key, key) == 0 &&
+                 !IS_MARKED(atomic_load_explicit(&curr->next, memory_order_acquire));
+    exitOp(self);
+    return found;
+}
+
+size_t lfslSize(LockFreeSortedList* list) {
+    if (list == NULL) {
+        fprintf(stderr, "Error: LockFreeSortedList is NULL\n");
+        return 0;
+    }
+    return atomic_load_explicit(&list->size, memory_order_relaxed);
+}
+
+void lfslThreadExit(LockFreeSortedList* list) {
+    if (list == NULL) {
+        fprintf(stderr, "Error: LockFreeSortedList is NULL\n");
+        return;
+    }
+    LFSLParticipant* self = joinList(list);
+    if (self == NULL) return;
+    // Limbo nodes may still be visible to others, so they are parked on the
+    // orphan list and reclaimed when the list is freed.
+    for (int b = 0; b < 3; b++) {
+        LFSLNode* chain = self->limbo[b];
+        self->limbo[b] = NULL;
+        if (chain == NULL) continue;
+        LFSLNode* last = chain;
+        while (last->retiredNext != NULL) last = last->retiredNext;
+        LFSLNode* head = atomic_load_explicit(&list->orphans, memory_order_relaxed);
+        do {
+            last->retiredNext = head;
+        } while (!atomic_compare_exchange_weak_explicit(&list->orphans, &head, chain,
+                                                        memory_order_release, memory_order_relaxed));
+    }
+    self->retired = 0;
+    threadCache.list = NULL;
+    atomic_store_explicit(&self->owner, NULL, memory_order_release);
+}
+
+void freeLockFreeSortedList(LockFreeSortedList* list) {
+    if (list == NULL) return;
+    LFSLNode* node = NODE_OF(atomic_load_explicit(&list->head.next, memory_order_relaxed));
+    while (node != NULL) {
+        LFSLNode* next = NODE_OF(atomic_load_explicit(&node->next, memory_order_relaxed));
+        node->retiredNext = NULL;
+        reclaimChain(list, node);
+        node = next;
+    }
+    for (int i = 0; i < LFSL_MAX_THREADS; i++) {
+        for (int b = 0; b < 3; b++) reclaimChain(list, list->participants[i].limbo[b]);
+    }
+    reclaimChain(list, atomic_load_explicit(&list->orphans, memory_order_relaxed));
+    if (threadCache.list == list) threadCache.list = NULL;
+    delete(list);
+}
@@ -0,0 +1,218 @@
+#include "lfstack.h"
+#include <stdio.h>
+
+#define REF(word) ((uint32_t)(word))
+#define TAG(word) ((uint32_t)((word) >> 32))
+#define PACK(tag, ref) (((uint64_t)(uint32_t)(tag) << 32) | (uint32_t)(ref))
+
+#define CHUNK_BASE ((uint64_t)1 << LFSTACK_CHUNK_SHIFT)
+#define MAX_NODES (((uint64_t)1 << (LFSTACK_MAX_CHUNKS + LFSTACK_CHUNK_SHIFT)) - CHUNK_BASE)
+
+// Chunk k holds CHUNK_BASE << k nodes, so index + CHUNK_BASE has its highest
+// bit at position k + LFSTACK_CHUNK_SHIFT.
+static unsigned chunkOf(uint64_t index) {
+    uint64_t value = index + CHUNK_BASE;
+#if defined(__GNUC__) || defined(__clang__)
+    unsigned top = (unsigned)(63 - __builtin_clzll(value));
+#else
+    unsigned top = 0;
+    while (value >>= 1) top++;
+#endif
+    return top - LFSTACK_CHUNK_SHIFT;
+}
+
+static LFStackNode* nodeAt(LockFreeStack* stack, uint32_t ref) {
+    uint64_t index = (uint64_t)ref - 1;
+    unsigned chunk = chunkOf(index);
+    LFStackNode* nodes = atomic_load_explicit(&stack->chunks[chunk], memory_order_acquire);
+    return &nodes[index + CHUNK_BASE - (CHUNK_BASE << chunk)];
+}
+
+static void listPush(LockFreeStack* stack, _Atomic(uint64_t)* head, uint32_t ref) {
+    LFStackNode* node = nodeAt(stack, ref);
+    uint64_t old = atomic_load_explicit(head, memory_order_relaxed);
+    do {
+        atomic_store_explicit(&node->next, REF(old), memory_order_relaxed);
+    } while (!atomic_compare_exchange_weak_explicit(head, &old, PACK(TAG(old) + 1, ref),
+                                                    memory_order_release, memory_order_relaxed));
+}
+
+static uint32_t listPop(LockFreeStack* stack, _Atomic(uint64_t)* head) {
+    uint64_t old = atomic_load_explicit(head, memory_order_acquire);
+    while (REF(old) != 0) {
+        // The node may be recycled under us; its memory stays valid and the
+        // tag makes the CAS fail if anything changed since the load.
+        uint32_t next = atomic_load_explicit(&nodeAt(stack, REF(old))->next, memory_order_relaxed);
+        if (atomic_compare_exchange_weak_explicit(head, &old, PACK(TAG(old) + 1, next),
+                                                  memory_order_acquire, memory_order_acquire)) {
+            return REF(old);
+        }
+    }
+    return 0;
+}
+
+// Back the next index with a chunk before claiming it, so a failed
+// allocation never leaves a claimed index without storage.
+static uint32_t acquireNode(LockFreeStack* stack) {
+    uint32_t ref = listPop(stack, &stack->freeList);
+    if (ref != 0) return ref;
+
+    uint64_t index = atomic_load_explicit(&stack->nextNode, memory_order_relaxed);
+    do {
+        if (index >= MAX_NODES) {
+            fprintf(stderr, "Error: LockFreeStack node limit reached\n");
+            return 0;
+        }
+        unsigned chunk = chunkOf(index);
+        if (atomic_load_explicit(&stack->chunks[chunk], memory_order_acquire) == NULL) {
+            LFStackNode* nodes = (LFStackNode*)calloc((size_t)(CHUNK_BASE << chunk), sizeof(LFStackNode));
+            if (nodes == NULL) {
+                fprintf(stderr, "Error: Memory allocation failed for LockFreeStack nodes\n");
+                return 0;
+            }
+            LFStackNode* expected = NULL;
+            if (!atomic_compare_exchange_strong_explicit(&stack->chunks[chunk], &expected, nodes,
+                                                         memory_order_acq_rel, memory_order_acquire)) {
+                free(nodes);  // Another thread installed this chunk first.
+            }
+        }
+    } while (!atomic_compare_exchange_weak_explicit(&stack->nextNode, &index, index + 1,
+                                                    memory_order_relaxed, memory_order_relaxed));
+    return (uint32_t)(index + 1);
+}
+
+static LFStackSlot* pickSlot(LockFreeStack* stack) {
+    static RST_THREAD_LOCAL uint32_t seed = 0;
+    if (seed == 0) seed = (uint32_t)(uintptr_t)&seed | 1u;
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    return &stack->elimination[seed % LFSTACK_ELIMINATION_SLOTS];
+}
+
+// Offer a node to a concurrent pop. Every slot transition bumps the tag, so a
+// withdrawing pusher cannot confuse its own offer with a later one.
+static bool eliminatePush(LockFreeStack* stack, uint32_t ref) {
+    LFStackSlot* slot = pickSlot(stack);
+    uint64_t current = atomic_load_explicit(&slot->offer, memory_order_relaxed);
+    if (REF(current) != 0) return false;
+    uint64_t offer = PACK(TAG(current) + 1, ref);
+    if (!atomic_compare_exchange_strong_explicit(&slot->offer, &current, offer,
+                                                 memory_order_release, memory_order_relaxed)) {
+        return false;
+    }
+    for (int i = 0; i < LFSTACK_ELIMINATION_SPINS; i++) {
+        if (atomic_load_explicit(&slot->offer, memory_order_relaxed) != offer) return true;
+    }
+    return !atomic_compare_exchange_strong_explicit(&slot->offer, &offer, PACK(TAG(offer) + 1, 0),
+                                                    memory_order_relaxed, memory_order_relaxed);
+}
+
+static uint32_t eliminatePop(LockFreeStack* stack) {
+    LFStackSlot* slot = pickSlot(stack);
+    uint64_t current = atomic_load_explicit(&slot->offer, memory_order_acquire);
+    if (REF(current) == 0) return 0;
+    if (!atomic_compare_exchange_strong_explicit(&slot->offer, &current, PACK(TAG(current) + 1, 0),
+                                                 memory_order_acquire, memory_order_relaxed)) {
+        return 0;
+    }
+    return REF(current);
+}
+
+static void* takeNode(LockFreeStack* stack, uint32_t ref) {
+    void* data = atomic_load_explicit(&nodeAt(stack, ref)->data, memory_order_relaxed);
+    listPush(stack, &stack->freeList, ref);
+    return data;
+}
+
+LockFreeStack* createLockFreeStack(void) {
+    LockFreeStack* stack = new(LockFreeStack);
+    if (stack == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed for LockFreeStack\n");
+        return NULL;
+    }
+    atomic_init(&stack->top, 0);
+    atomic_init(&stack->freeList, 0);
+    atomic_init(&stack->nextNode, 0);
+    atomic_init(&stack->size, 0);
+    for (int i = 0; i < LFSTACK_MAX_CHUNKS; i++) atomic_init(&stack->chunks[i], NULL);
+    for (int i = 0; i < LFSTACK_ELIMINATION_SLOTS; i++) atomic_init(&stack->elimination[i].offer, 0);
+    return stack;
+}
+
+size_t lfstackSize(LockFreeStack* stack) {
+    if (stack == NULL) {
+        fprintf(stderr, "Error: LockFreeStack is NULL\n");
+        return 0;
+    }
+    return atomic_load_explicit(&stack->size, memory_order_relaxed);
+}
+
+bool lfstackIsEmpty(LockFreeStack* stack) {
+    if (stack == NULL) {
+        fprintf(stderr, "Error: LockFreeStack is NULL\n");
+        return true;
+    }
+    return REF(atomic_load_explicit(&stack->top, memory_order_relaxed)) == 0;
+}
+
+bool lfstackPush(LockFreeStack* stack, void* data) {
+    if (stack == NULL) {
+        fprintf(stderr, "Error: LockFreeStack is NULL\n");
+        return false;
+    }
+    uint32_t ref = acquireNode(stack);
+    if (ref == 0) return false;
+    LFStackNode* node = nodeAt(stack, ref);
+    atomic_store_explicit(&node->data, data, memory_order_relaxed);
+
+    uint64_t old = atomic_load_explicit(&stack->top, memory_order_relaxed);
+    for (;;) {
+        atomic_store_explicit(&node->next, REF(old), memory_order_relaxed);
+        if (atomic_compare_exchange_weak_explicit(&stack->top, &old, PACK(TAG(old) + 1, ref),
+                                                  memory_order_release, memory_order_relaxed)) {
+            atomic_fetch_add_explicit(&stack->size, 1, memory_order_relaxed);
+            return true;
+        }
+        if (eliminatePush(stack, ref)) return true;
+        old = atomic_load_explicit(&stack->top, memory_order_relaxed);
+    }
+}
+
+void* lfstackPop(LockFreeStack* stack) {
+    if (stack == NULL) {
+        fprintf(stderr, "Error: LockFreeStack is NULL\n");
+        return NULL;
+    }
+    uint64_t old = atomic_load_explicit(&stack->top, memory_order_acquire);
+    for (;;) {
+        if (REF(old) == 0) return NULL;
+        uint32_t next = atomic_load_explicit(&nodeAt(stack, REF(old))->next, memory_order_relaxed);
+        if (atomic_compare_exchange_weak_explicit(&stack->top, &old, PACK(TAG(old) + 1, next),
+                                                  memory_order_acquire, memory_order_acquire)) {
+            atomic_fetch_sub_explicit(&stack->size, 1, memory_order_relaxed);
+            return takeNode(stack, REF(old));
+        }
+        uint32_t ref = eliminatePop(stack);
+        if (ref != 0) return takeNode(stack, ref);
+        old = atomic_load_explicit(&stack->top, memory_order_acquire);
+    }
+}
+
+void* lfstackPeek(LockFreeStack* stack) {
+    if (stack == NULL) {
+        fprintf(stderr, "Error: LockFreeStack is NULL\n");
+        return NULL;
+    }
+    uint64_t top = atomic_load_explicit(&stack->top, memory_order_acquire);
+    if (REF(top) == 0) return NULL;
+    return atomic_load_explicit(&nodeAt(stack, REF(top))->data, memory_order_relaxed);
+}
+
+void freeLockFreeStack(LockFreeStack* stack) {
+    if (stack == NULL) return;
+    for (int i = 0; i < LFSTACK_MAX_CHUNKS; i++) {
+        free(atomic_load_explicit(&stack->chunks[i], memory_order_relaxed));
+    }
+    delete(stack);
+}
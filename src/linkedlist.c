@@ -26,6 +26,8 @@ SingleLinkedList* createSingleLinkedList() {
     list->head = NULL;
     list->tail = NULL;
     list->size = 0;
+    list->cursor = NULL;
+    list->cursorIndex = 0;
     return list;
 }
 
@@ -40,6 +42,127 @@ SLLNode* createSLLNode(void* data) {
     return node;
 }
 
+/*       NODE POOL
+ * ==================== */
+#define SLL_POOL_DEFAULT_SLAB 64
+
+void SLL_initNodePool(SLLNodePool* pool, unsigned int slabSize, unsigned int highWater) {
+    if (pool == NULL) {
+        fprintf(stderr, "Error: SLLNodePool is NULL\n");
+        return;
+    }
+    pool->partial = NULL;
+    pool->full = NULL;
+    pool->freeCount = 0;
+    pool->totalCount = 0;
+    pool->slabSize = slabSize > 0 ? slabSize : SLL_POOL_DEFAULT_SLAB;
+    pool->highWater = highWater;
+}
+
+static void slabUnlink(SLLNodeSlab** list, SLLNodeSlab* slab) {
+    if (slab->prev != NULL) slab->prev->next = slab->next;
+    else *list = slab->next;
+    if (slab->next != NULL) slab->next->prev = slab->prev;
+}
+
+static void slabPush(SLLNodeSlab** list, SLLNodeSlab* slab) {
+    slab->prev = NULL;
+    slab->next = *list;
+    if (*list != NULL) (*list)->prev = slab;
+    *list = slab;
+}
+
+static bool poolRefill(SLLNodePool* pool, unsigned int count) {
+    SLLNodeSlab* slab = (SLLNodeSlab*)malloc(sizeof(SLLNodeSlab) + count * sizeof(SLLPoolNode));
+    if (slab == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed for SLLNodeSlab\n");
+        return false;
+    }
+    slab->count = count;
+    slab->freeCount = count;
+    slab->freeList = NULL;
+    for (unsigned int i = count; i > 0; i--) {
+        slab->nodes[i - 1].slab = slab;
+        slab->nodes[i - 1].node.next = slab->freeList;
+        slab->freeList = &slab->nodes[i - 1].node;
+    }
+    slabPush(&pool->partial, slab);
+    pool->freeCount += count;
+    pool->totalCount += count;
+    return true;
+}
+
+SLLNode* SLL_poolAcquire(SLLNodePool* pool, void* data) {
+    if (pool == NULL) {
+        fprintf(stderr, "Error: SLLNodePool is NULL\n");
+        return NULL;
+    }
+    if (pool->partial == NULL && !poolRefill(pool, pool->slabSize)) return NULL;
+    SLLNodeSlab* slab = pool->partial;
+    SLLNode* node = slab->freeList;
+    slab->freeList = node->next;
+    slab->freeCount--;
+    pool->freeCount--;
+    if (slab->freeCount == 0) {
+        slabUnlink(&pool->partial, slab);
+        slabPush(&pool->full, slab);
+    }
+    node->data = data;
+    node->next = NULL;
+    return node;
+}
+
+bool SLL_poolReserve(SLLNodePool* pool, unsigned int count) {
+    if (pool == NULL) {
+        fprintf(stderr, "Error: SLLNodePool is NULL\n");
+        return false;
+    }
+    if (count <= pool->freeCount) return true;
+    unsigned int shortfall = count - pool->freeCount;
+    return poolRefill(pool, shortfall > pool->slabSize ? shortfall : pool->slabSize);
+}
+
+void SLL_poolRelease(SLLNodePool* pool, SLLNode* node) {
+    if (pool == NULL || node == NULL) {
+        fprintf(stderr, "Error: SLLNodePool or node is NULL\n");
+        return;
+    }
+    SLLNodeSlab* slab = ((SLLPoolNode*)node)->slab;
+    node->next = slab->freeList;
+    slab->freeList = node;
+    slab->freeCount++;
+    pool->freeCount++;
+    if (slab->freeCount == 1) {
+        slabUnlink(&pool->full, slab);
+        slabPush(&pool->partial, slab);
+    }
+    // Release an empty slab only if the rest still cover highWater, so a
+    // workload hovering at a slab boundary keeps hitting the cache.
+    if (slab->freeCount == slab->count && pool->freeCount - slab->count >= pool->highWater &&
+        pool->totalCount > slab->count) {
+        slabUnlink(&pool->partial, slab);
+        pool->freeCount -= slab->count;
+        pool->totalCount -= slab->count;
+        free(slab);
+    }
+}
+
+void SLL_destroyNodePool(SLLNodePool* pool) {
+    if (pool == NULL) return;
+    SLLNodeSlab* lists[2] = { pool->partial, pool->full };
+    for (int i = 0; i < 2; i++) {
+        while (lists[i] != NULL) {
+            SLLNodeSlab* next = lists[i]->next;
+            free(lists[i]);
+            lists[i] = next;
+        }
+    }
+    pool->partial = NULL;
+    pool->full = NULL;
+    pool->freeCount = 0;
+    pool->totalCount = 0;
+}
+
 /*      GETTERS
  * ==================== */
 void* SLL_getNodeData(SLLNode* node) {
@@ -76,6 +199,27 @@ void SLL_setNextNode(SLLNode* node, SLLNode* next) {
     node->next = next;
 }
 
+/*    POSITION CURSOR
+ * ==================== */
+// The list remembers the last node reached by position. A lookup at or past
+// it resumes from there, so ascending index loops cost O(1) per step.
+static SLLNode* sllSeek(SingleLinkedList* list, int pos) {
+    if (pos == list->size - 1) return list->tail;
+    SLLNode* current = list->head;
+    int index = 0;
+    if (list->cursor != NULL && list->cursorIndex <= pos) {
+        current = list->cursor;
+        index = list->cursorIndex;
+    }
+    while (index < pos) {
+        current = current->next;
+        index++;
+    }
+    list->cursor = current;
+    list->cursorIndex = pos;
+    return current;
+}
+
 /*     INSERT NODE
  * ==================== */
 void SLL_insertFront(SingleLinkedList* list, void* data) {
@@ -93,6 +237,7 @@ void SLL_insertFront(SingleLinkedList* list, void* data) {
         list->head = newNode;
     }
     list->size++;
+    if (list->cursor != NULL) list->cursorIndex++;
 }
 
 void SLL_insertBack(SingleLinkedList* list, void* data) {
@@ -130,13 +275,12 @@ void SLL_insertNode(SingleLinkedList* list, void* data, int pos) {
         fprintf(stderr, "Error: Memory allocation failed for new node\n");
         return;
     }
-    SLLNode* current = list->head;
-    for (int i = 0; i < pos - 1; i++) {
-        current = current->next;
-    }
+    SLLNode* current = sllSeek(list, pos - 1);
     newNode->next = current->next;
     current->next = newNode;
     list->size++;
+    list->cursor = newNode;
+    list->cursorIndex = pos;
 }
 
 /*     REMOVE NODE
@@ -146,6 +290,8 @@ void SLL_removeFront(SingleLinkedList* list, SLLNode* node) {
         fprintf(stderr, "Error: SLLNode is NULL\n");
         return;
     }
+    if (list->cursor == node || list->head != node) list->cursor = NULL;
+    else if (list->cursor != NULL) list->cursorIndex--;
     if (list->head == node) {
         list->head = node->next;
         if (list->head == NULL) {
@@ -174,6 +320,8 @@ void SLL_removeBack(SingleLinkedList* list, SLLNode* node) {
         return;
     }
     if (list->head == NULL) return;
+    // Dropping the tail leaves earlier indices intact.
+    if (list->cursor == node || list->tail != node) list->cursor = NULL;
 
     if (list->head == node) {
         list->head = node->next;
@@ -216,10 +364,7 @@ void SLL_removeNode(SingleLinkedList* list, SLLNode* node, int pos) {
         SLL_removeBack(list, node);
         return;
     }
-    SLLNode* current = list->head;
-    for (int i = 0; i < pos - 1; i++) {
-        current = current->next;
-    }
+    SLLNode* current = sllSeek(list, pos - 1);
     current->next = node->next;
     delete(node);
     list->size--;
@@ -248,10 +393,7 @@ void* SLL_getNode(SingleLinkedList* list, int pos) {
         fprintf(stderr, "Error: Invalid position for retrieval\n");
         return NULL;
     }
-    SLLNode* current = list->head;
-    for (int i = 0; i < pos; i++) {
-        current = current->next;
-    }
+    SLLNode* current = sllSeek(list, pos);
     if (current == NULL) {
         fprintf(stderr, "Error: Node not found\n");
         return NULL;
@@ -260,6 +402,136 @@ void* SLL_getNode(SingleLinkedList* list, int pos) {
 }
 
 
+/*   CONCAT AND SPLIT
+ * ==================== */
+void SLL_concat(SingleLinkedList* dst, SingleLinkedList* src) {
+    if (dst == NULL || src == NULL) {
+        fprintf(stderr, "Error: List is NULL\n");
+        return;
+    }
+    if (dst == src || src->size == 0) return;
+    if (dst->size == 0) dst->head = src->head;
+    else dst->tail->next = src->head;
+    dst->tail = src->tail;
+    dst->size += src->size;
+    src->head = NULL;
+    src->tail = NULL;
+    src->size = 0;
+    src->cursor = NULL;
+}
+
+SingleLinkedList* SLL_splitAt(SingleLinkedList* list, SLLNode* node) {
+    if (list == NULL) {
+        fprintf(stderr, "Error: List is NULL\n");
+        return NULL;
+    }
+    // Count the kept prefix; this also checks that node belongs to list.
+    int kept = 0;
+    if (node != NULL) {
+        SLLNode* current = list->head;
+        while (current != NULL && current != node) {
+            current = current->next;
+            kept++;
+        }
+        if (current == NULL) {
+            fprintf(stderr, "Error: Node does not belong to list\n");
+            return NULL;
+        }
+        kept++;
+    }
+    SingleLinkedList* rest = createSingleLinkedList();
+    if (rest == NULL) return NULL;
+    if (kept == list->size) return rest;
+
+    rest->head = (node == NULL) ? list->head : node->next;
+    rest->tail = list->tail;
+    rest->size = list->size - kept;
+    if (node == NULL) list->head = NULL;
+    else node->next = NULL;
+    list->tail = node;
+    list->size = kept;
+    if (list->cursorIndex >= kept) list->cursor = NULL;
+    return rest;
+}
+
+
+/*     SORT AND MERGE
+ * ==================== */
+// Detach the first n nodes starting at head and return the node after them.
+static SLLNode* sllSplit(SLLNode* head, int n) {
+    while (head != NULL && --n > 0) head = head->next;
+    if (head == NULL) return NULL;
+    SLLNode* rest = head->next;
+    head->next = NULL;
+    return rest;
+}
+
+// Stable merge: on ties the node from a comes first.
+static SLLNode* sllMerge(SLLNode* a, SLLNode* b, ListCompare cmp, SLLNode** tail) {
+    SLLNode dummy;
+    SLLNode* last = &dummy;
+    while (a != NULL && b != NULL) {
+        if (cmp(a->data, b->data) <= 0) {
+            last->next = a;
+            a = a->next;
+        }
+        else {
+            last->next = b;
+            b = b->next;
+        }
+        last = last->next;
+    }
+    last->next = (a != NULL) ? a : b;
+    while (last->next != NULL) last = last->next;
+    *tail = last;
+    return dummy.next;
+}
+
+void SLL_sort(SingleLinkedList* list, ListCompare cmp) {
+    if (list == NULL || cmp == NULL) {
+        fprintf(stderr, "Error: List or comparator is NULL\n");
+        return;
+    }
+    if (list->size < 2) return;
+    SLLNode dummy;
+    dummy.next = list->head;
+    SLLNode* tail = NULL;
+    for (int width = 1; width < list->size; width *= 2) {
+        SLLNode* current = dummy.next;
+        tail = &dummy;
+        while (current != NULL) {
+            SLLNode* left = current;
+            SLLNode* right = sllSplit(left, width);
+            current = sllSplit(right, width);
+            SLLNode* newTail = NULL;
+            SLLNode* merged = sllMerge(left, right, cmp, &newTail);
+            tail->next = merged;
+            tail = newTail;
+        }
+    }
+    list->head = dummy.next;
+    list->tail = tail;
+    list->cursor = NULL;
+}
+
+void SLL_mergeSorted(SingleLinkedList* dst, SingleLinkedList* src, ListCompare cmp) {
+    if (dst == NULL || src == NULL || cmp == NULL) {
+        fprintf(stderr, "Error: List or comparator is NULL\n");
+        return;
+    }
+    if (dst == src || src->size == 0) return;
+    SLLNode* tail = NULL;
+    dst->head = sllMerge(dst->head, src->head, cmp, &tail);
+    dst->tail = tail;
+    dst->size += src->size;
+    dst->cursor = NULL;
+    src->head = NULL;
+    src->tail = NULL;
+    src->size = 0;
+    src->cursor = NULL;
+}
+
+
 /*  DEALOC AND DESTRUCT
  * ==================== */
 void SLL_clearList(SingleLinkedList* list) {
@@ -272,6 +544,7 @@ void SLL_clearList(SingleLinkedList* list) {
     list->head = NULL;
     list->tail = NULL;
     list->size = 0;
+    list->cursor = NULL;
 }
 
 void SLL_freeList(SingleLinkedList* list) {
@@ -338,6 +611,8 @@ DoublyLinkedList* createDoublyLinkedList() {
     list->head = NULL;
     list->tail = NULL;
     list->size = 0;
+    list->cursor = NULL;
+    list->cursorIndex = 0;
     return list;
 }
 
@@ -407,6 +682,39 @@ void DLL_setPrevNode(DLLNode* node, DLLNode* prev) {
     node->prev = prev;
 }
 
+/*    POSITION CURSOR
+ * ==================== */
+// Start from whichever of head, tail and the cached node is closest.
+static DLLNode* dllSeek(DoublyLinkedList* list, int pos) {
+    DLLNode* current = list->head;
+    int index = 0;
+    int distance = pos;
+    if (list->size - 1 - pos < distance) {
+        current = list->tail;
+        index = list->size - 1;
+        distance = list->size - 1 - pos;
+    }
+    if (list->cursor != NULL) {
+        int fromCursor = pos - list->cursorIndex;
+        if (fromCursor < 0) fromCursor = -fromCursor;
+        if (fromCursor < distance) {
+            current = list->cursor;
+            index = list->cursorIndex;
+        }
+    }
+    while (index < pos) {
+        current = current->next;
+        index++;
+    }
+    while (index > pos) {
+        current = current->prev;
+        index--;
+    }
+    list->cursor = current;
+    list->cursorIndex = pos;
+    return current;
+}
+
 /*     INSERT NODE
  * ==================== */
 
@@ -426,6 +734,7 @@ void DLL_insertFront(DoublyLinkedList* list, void* data) {
         list->head = newNode;
     }
     list->size++;
+    if (list->cursor != NULL) list->cursorIndex++;
 }
 
 void DLL_insertBack(DoublyLinkedList* list, void* data) {
@@ -464,10 +773,7 @@ void DLL_insertNode(DoublyLinkedList* list, void* data, int pos) {
         fprintf(stderr, "Error: Memory allocation failed for new node\n");
         return;
     }
-    DLLNode* current = list->head;
-    for (int i = 0; i < pos - 1; i++) {
-        current = current->next;
-    }
+    DLLNode* current = dllSeek(list, pos - 1);
     newNode->next = current->next;
     newNode->prev = current;
     if (current->next != NULL) {
@@ -475,6 +781,8 @@ void DLL_insertNode(DoublyLinkedList* list, void* data, int pos) {
     }
     current->next = newNode;
     list->size++;
+    list->cursor = newNode;
+    list->cursorIndex = pos;
 }
 
 /*     REMOVE NODE
@@ -485,6 +793,8 @@ void DLL_removeFront(DoublyLinkedList* list, DLLNode* node) {
         fprintf(stderr, "Error: DLLNode is NULL\n");
         return;
     }
+    if (list->cursor == node || list->head != node) list->cursor = NULL;
+    else if (list->cursor != NULL) list->cursorIndex--;
     if (list->head == node) {
         list->head = node->next;
         if (list->head != NULL) {
@@ -509,6 +819,7 @@ void DLL_removeBack(DoublyLinkedList* list, DLLNode* node) {
         fprintf(stderr, "Error: DLLNode is NULL\n");
         return;
     }
+    if (list->cursor == node || list->tail != node) list->cursor = NULL;
     if (list->tail == node) {
         list->tail = node->prev;
         if (list->tail != NULL) {
@@ -545,6 +856,13 @@ void DLL_removeNode(DoublyLinkedList* list, DLLNode* node, int pos) {
         DLL_removeBack(list, node);
         return;
     }
+    if (list->cursor == node) {
+        list->cursor = node->prev;
+        list->cursorIndex = pos - 1;
+    }
+    else if (list->cursor != NULL && list->cursorIndex > pos) {
+        list->cursorIndex--;
+    }
     if (node->prev != NULL) {
         node->prev->next = node->next;
     }
@@ -579,11 +897,142 @@ void* DLL_getNode(DoublyLinkedList* list, int pos) {
         fprintf(stderr, "Error: Invalid position for retrieval\n");
         return NULL;
     }
-    DLLNode* current = list->head;
-    for (int i = 0; i < pos; i++) {
-        current = current->next;
+    return dllSeek(list, pos)->data;
+}
+
+/*   CONCAT AND SPLICE
+ * ==================== */
+void DLL_concat(DoublyLinkedList* dst, DoublyLinkedList* src) {
+    if (dst == NULL || src == NULL) {
+        fprintf(stderr, "Error: List is NULL\n");
+        return;
     }
-    return current->data;
+    if (dst == src || src->size == 0) return;
+    if (dst->size == 0) {
+        dst->head = src->head;
+    }
+    else {
+        dst->tail->next = src->head;
+        src->head->prev = dst->tail;
+    }
+    dst->tail = src->tail;
+    dst->size += src->size;
+    src->head = NULL;
+    src->tail = NULL;
+    src->size = 0;
+    src->cursor = NULL;
+}
+
+bool DLL_splice(DoublyLinkedList* dst, DLLNode* before, DoublyLinkedList* src, DLLNode* first, DLLNode* last,
+                int count) {
+    if (dst == NULL || src == NULL || first == NULL || last == NULL) {
+        fprintf(stderr, "Error: List or node is NULL\n");
+        return false;
+    }
+    if (dst == src) {
+        fprintf(stderr, "Error: Cannot splice a list into itself\n");
+        return false;
+    }
+    // Ends that touch a list boundary must be that list's head/tail; this
+    // catches nodes from the wrong list before head/tail are rewritten.
+    if ((first->prev == NULL && src->head != first) || (last->next == NULL && src->tail != last) ||
+        (before != NULL && before->prev == NULL && dst->head != before) || count > src->size) {
+        fprintf(stderr, "Error: Splice nodes do not belong to the given lists\n");
+        return false;
+    }
+    if (count <= 0) {
+        count = 1;
+        DLLNode* current = first;
+        while (current != last && current != NULL) {
+            current = current->next;
+            count++;
+        }
+        if (current == NULL || count > src->size) {
+            fprintf(stderr, "Error: last does not follow first in source list\n");
+            return false;
+        }
+    }
+
+    if (first->prev != NULL) first->prev->next = last->next;
+    else src->head = last->next;
+    if (last->next != NULL) last->next->prev = first->prev;
+    else src->tail = first->prev;
+    src->size -= count;
+    src->cursor = NULL;
+    dst->cursor = NULL;
+
+    DLLNode* after = before;
+    DLLNode* prevNode = (before != NULL) ? before->prev : dst->tail;
+    first->prev = prevNode;
+    last->next = after;
+    if (prevNode != NULL) prevNode->next = first;
+    else dst->head = first;
+    if (after != NULL) after->prev = last;
+    else dst->tail = last;
+    dst->size += count;
+    return true;
+}
+
+/*        SORT
+ * ==================== */
+static DLLNode* dllSplit(DLLNode* head, int n) {
+    while (head != NULL && --n > 0) head = head->next;
+    if (head == NULL) return NULL;
+    DLLNode* rest = head->next;
+    head->next = NULL;
+    return rest;
+}
+
+// Merges on next pointers only; DLL_sort rebuilds prev links afterwards.
+static DLLNode* dllMerge(DLLNode* a, DLLNode* b, ListCompare cmp, DLLNode** tail) {
+    DLLNode dummy;
+    DLLNode* last = &dummy;
+    while (a != NULL && b != NULL) {
+        if (cmp(a->data, b->data) <= 0) {
+            last->next = a;
+            a = a->next;
+        }
+        else {
+            last->next = b;
+            b = b->next;
+        }
+        last = last->next;
+    }
+    last->next = (a != NULL) ? a : b;
+    while (last->next != NULL) last = last->next;
+    *tail = last;
+    return dummy.next;
+}
+
+void DLL_sort(DoublyLinkedList* list, ListCompare cmp) {
+    if (list == NULL || cmp == NULL) {
+        fprintf(stderr, "Error: List or comparator is NULL\n");
+        return;
+    }
+    if (list->size < 2) return;
+    DLLNode dummy;
+    dummy.next = list->head;
+    for (int width = 1; width < list->size; width *= 2) {
+        DLLNode* current = dummy.next;
+        DLLNode* tail = &dummy;
+        while (current != NULL) {
+            DLLNode* left = current;
+            DLLNode* right = dllSplit(left, width);
+            current = dllSplit(right, width);
+            DLLNode* newTail = NULL;
+            DLLNode* merged = dllMerge(left, right, cmp, &newTail);
+            tail->next = merged;
+            tail = newTail;
+        }
+    }
+    DLLNode* prev = NULL;
+    for (DLLNode* node = dummy.next; node != NULL; node = node->next) {
+        node->prev = prev;
+        prev = node;
+    }
+    list->head = dummy.next;
+    list->tail = prev;
+    list->cursor = NULL;
 }
 
 /*  DEALOC AND DESTRUCT
@@ -599,6 +1048,7 @@ void DLL_clearList(DoublyLinkedList* list) {
     list->head = NULL;
     list->tail = NULL;
     list->size = 0;
+    list->cursor = NULL;
 }
 
 void DLL_freeList(DoublyLinkedList* list) {
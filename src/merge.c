@@ -0,0 +1,176 @@
+#include "merge.h"
+#include <stdio.h>
+
+#define DEFAULT_CURSOR_CAPACITY 8
+
+static int cursorCompare(const void* a, const void* b) {
+    const MergeCursor* ca = (const MergeCursor*)a;
+    const MergeCursor* cb = (const MergeCursor*)b;
+    int result = ca->owner->cmp(ca->current, cb->current);
+    if (result != 0) return result;
+    return (ca->order > cb->order) - (ca->order < cb->order);
+}
+
+// Load the next item of a cursor into `current`; false once exhausted.
+static bool advanceCursor(MergeCursor* cursor) {
+    if (cursor->array != NULL) {
+        if (cursor->pos >= cursor->length) return false;
+        cursor->current = cursor->array[cursor->pos++];
+        return true;
+    }
+    if (cursor->next != NULL) {
+        cursor->current = cursor->next(cursor->state);
+        return cursor->current != NULL;
+    }
+    if (cursor->node == NULL) return false;
+    cursor->current = cursor->node->data;
+    cursor->node = cursor->node->next;
+    return true;
+}
+
+// Emit the smallest current item. The winning cursor is advanced in place and
+// re-sifted with heapReplaceTop, so each output costs one sift instead of a
+// pop plus a push.
+static void* takeTop(Heap* heap) {
+    MergeCursor* top = (MergeCursor*)heap->data[0];
+    void* item = top->current;
+    if (advanceCursor(top)) {
+        heapReplaceTop(heap, top);
+    } else {
+        heapPop(heap);
+    }
+    return item;
+}
+
+static MergeCursor* addCursor(MergeIterator* merge) {
+    if (merge->count == merge->capacity) {
+        size_t newCapacity = merge->capacity == 0 ? DEFAULT_CURSOR_CAPACITY : merge->capacity * 2;
+        MergeCursor** resized = (MergeCursor**)realloc(merge->cursors, newCapacity * sizeof(MergeCursor*));
+        if (resized == NULL) {
+            fprintf(stderr, "Error: Memory allocation failed while growing merge cursors\n");
+            return NULL;
+        }
+        merge->cursors = resized;
+        merge->capacity = newCapacity;
+    }
+    MergeCursor* cursor = new(MergeCursor);
+    if (cursor == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed for MergeCursor\n");
+        return NULL;
+    }
+    cursor->current = NULL;
+    cursor->array = NULL;
+    cursor->length = 0;
+    cursor->pos = 0;
+    cursor->node = NULL;
+    cursor->next = NULL;
+    cursor->state = NULL;
+    cursor->order = merge->count;
+    cursor->owner = merge;
+    merge->cursors[merge->count++] = cursor;
+    return cursor;
+}
+
+static bool activateCursor(MergeIterator* merge, MergeCursor* cursor) {
+    if (!advanceCursor(cursor)) return true;
+    return heapPush(merge->heap, cursor);
+}
+
+MergeIterator* createMergeIterator(HeapCompare cmp) {
+    if (cmp == NULL) {
+        fprintf(stderr, "Error: Comparator must not be NULL\n");
+        return NULL;
+    }
+    MergeIterator* merge = new(MergeIterator);
+    if (merge == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed for MergeIterator\n");
+        return NULL;
+    }
+    merge->heap = createHeap(cursorCompare);
+    if (merge->heap == NULL) {
+        delete(merge);
+        return NULL;
+    }
+    merge->cursors = NULL;
+    merge->count = 0;
+    merge->capacity = 0;
+    merge->cmp = cmp;
+    return merge;
+}
+
+bool mergeAddArray(MergeIterator* merge, void** items, size_t count) {
+    if (merge == NULL || (items == NULL && count > 0)) {
+        fprintf(stderr, "Error: MergeIterator or items array is NULL\n");
+        return false;
+    }
+    if (count == 0) return true;
+    MergeCursor* cursor = addCursor(merge);
+    if (cursor == NULL) return false;
+    cursor->array = items;
+    cursor->length = count;
+    return activateCursor(merge, cursor);
+}
+
+bool mergeAddList(MergeIterator* merge, SingleLinkedList* list) {
+    if (merge == NULL || list == NULL) {
+        fprintf(stderr, "Error: MergeIterator or list is NULL\n");
+        return false;
+    }
+    if (list->head == NULL) return true;
+    MergeCursor* cursor = addCursor(merge);
+    if (cursor == NULL) return false;
+    cursor->node = list->head;
+    return activateCursor(merge, cursor);
+}
+
+bool mergeAddSource(MergeIterator* merge, MergeSourceNext next, void* state) {
+    if (merge == NULL || next == NULL) {
+        fprintf(stderr, "Error: MergeIterator or source callback is NULL\n");
+        return false;
+    }
+    MergeCursor* cursor = addCursor(merge);
+    if (cursor == NULL) return false;
+    cursor->next = next;
+    cursor->state = state;
+    return activateCursor(merge, cursor);
+}
+
+bool mergeHasNext(MergeIterator* merge) {
+    if (merge == NULL) {
+        fprintf(stderr, "Error: MergeIterator is NULL\n");
+        return false;
+    }
+    return merge->heap->size > 0;
+}
+
+void* mergeNext(MergeIterator* merge) {
+    if (merge == NULL) {
+        fprintf(stderr, "Error: MergeIterator is NULL\n");
+        return NULL;
+    }
+    if (merge->heap->size == 0) return NULL;
+    return takeTop(merge->heap);
+}
+
+size_t mergeNextBatch(MergeIterator* merge, void** out, size_t max) {
+    if (merge == NULL || out == NULL) {
+        fprintf(stderr, "Error: MergeIterator or output buffer is NULL\n");
+        return 0;
+    }
+    Heap* heap = merge->heap;
+    size_t written = 0;
+    while (written < max && heap->size > 0) {
+        out[written++] = takeTop(heap);
+    }
+    return written;
+}
+
+void freeMergeIterator(MergeIterator* merge) {
+    if (merge == NULL) return;
+    for (size_t i = 0; i < merge->count; i++) {
+        delete(merge->cursors[i]);
+    }
+    free(merge->cursors);
+    freeHeap(merge->heap);
+    delete(merge);
+}
@@ -0,0 +1,179 @@
+#include "mpmcqueue.h"
+#include <stdio.h>
+#include <stdint.h>
+
+// Waking is skipped unless a sleeper registered itself. The seq_cst fence
+// after publishing pairs with the fence a sleeper issues after registering
+// and before its final retry, so either the sleeper sees the new item or we
+// see the sleeper. Signalling under the lock closes the retry/wait window.
+static void wakeIfWaiting(MPMCQueue* queue, atomic_int* waiting, pthread_cond_t* cond) {
+    atomic_thread_fence(memory_order_seq_cst);
+    if (atomic_load_explicit(waiting, memory_order_relaxed) == 0) return;
+    pthread_mutex_lock(&queue->lock);
+    pthread_cond_signal(cond);
+    pthread_mutex_unlock(&queue->lock);
+}
+
+static bool tryEnqueueCell(MPMCQueue* queue, void* item) {
+    size_t pos = atomic_load_explicit(&queue->enqueuePos, memory_order_relaxed);
+    MPMCCell* cell;
+    for (;;) {
+        cell = &queue->buffer[pos & queue->mask];
+        size_t seq = atomic_load_explicit(&cell->sequence, memory_order_acquire);
+        intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+        if (diff == 0) {
+            if (atomic_compare_exchange_weak_explicit(&queue->enqueuePos, &pos, pos + 1,
+                                                      memory_order_relaxed, memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            return false;
+        } else {
+            pos = atomic_load_explicit(&queue->enqueuePos, memory_order_relaxed);
+        }
+    }
+    cell->data = item;
+    atomic_store_explicit(&cell->sequence, pos + 1, memory_order_release);
+    return true;
+}
+
+static bool tryDequeueCell(MPMCQueue* queue, void** out) {
+    size_t pos = atomic_load_explicit(&queue->dequeuePos, memory_order_relaxed);
+    MPMCCell* cell;
+    for (;;) {
+        cell = &queue->buffer[pos & queue->mask];
+        size_t seq = atomic_load_explicit(&cell->sequence, memory_order_acquire);
+        intptr_t diff = (intptr_t)seq - (intptr_t)(pos + 1);
+        if (diff == 0) {
+            if (atomic_compare_exchange_weak_explicit(&queue->dequeuePos, &pos, pos + 1,
+                                                      memory_order_relaxed, memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            return false;
+        } else {
+            pos = atomic_load_explicit(&queue->dequeuePos, memory_order_relaxed);
+        }
+    }
+    *out = cell->data;
+    atomic_store_explicit(&cell->sequence, pos + queue->mask + 1, memory_order_release);
+    return true;
+}
+
+MPMCQueue* createMPMCQueue(size_t capacity) {
+    size_t rounded = 2;
+    while (rounded < capacity) rounded <<= 1;
+    MPMCQueue* queue = new(MPMCQueue);
+    if (queue == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed for MPMCQueue\n");
+        return NULL;
+    }
+    queue->buffer = (MPMCCell*)malloc(rounded * sizeof(MPMCCell));
+    if (queue->buffer == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed for MPMCQueue storage\n");
+        delete(queue);
+        return NULL;
+    }
+    for (size_t i = 0; i < rounded; i++) {
+        atomic_init(&queue->buffer[i].sequence, i);
+        queue->buffer[i].data = NULL;
+    }
+    queue->mask = rounded - 1;
+    atomic_init(&queue->enqueuePos, 0);
+    atomic_init(&queue->dequeuePos, 0);
+    atomic_init(&queue->waitingProducers, 0);
+    atomic_init(&queue->waitingConsumers, 0);
+    pthread_mutex_init(&queue->lock, NULL);
+    pthread_cond_init(&queue->notEmpty, NULL);
+    pthread_cond_init(&queue->notFull, NULL);
+    return queue;
+}
+
+size_t mpmcCapacity(MPMCQueue* queue) {
+    if (queue == NULL) {
+        fprintf(stderr, "Error: MPMCQueue is NULL\n");
+        return 0;
+    }
+    return queue->mask + 1;
+}
+
+size_t mpmcSize(MPMCQueue* queue) {
+    if (queue == NULL) {
+        fprintf(stderr, "Error: MPMCQueue is NULL\n");
+        return 0;
+    }
+    size_t dequeued = atomic_load_explicit(&queue->dequeuePos, memory_order_acquire);
+    size_t enqueued = atomic_load_explicit(&queue->enqueuePos, memory_order_acquire);
+    return enqueued > dequeued ? enqueued - dequeued : 0;
+}
+
+bool mpmcTryEnqueue(MPMCQueue* queue, void* item) {
+    if (queue == NULL) {
+        fprintf(stderr, "Error: MPMCQueue is NULL\n");
+        return false;
+    }
+    if (!tryEnqueueCell(queue, item)) return false;
+    wakeIfWaiting(queue, &queue->waitingConsumers, &queue->notEmpty);
+    return true;
+}
+
+bool mpmcTryDequeue(MPMCQueue* queue, void** out) {
+    if (queue == NULL || out == NULL) {
+        fprintf(stderr, "Error: MPMCQueue or output is NULL\n");
+        return false;
+    }
+    if (!tryDequeueCell(queue, out)) return false;
+    wakeIfWaiting(queue, &queue->waitingProducers, &queue->notFull);
+    return true;
+}
+
+void mpmcEnqueue(MPMCQueue* queue, void* item) {
+    if (queue == NULL) {
+        fprintf(stderr, "Error: MPMCQueue is NULL\n");
+        return;
+    }
+    if (tryEnqueueCell(queue, item)) {
+        wakeIfWaiting(queue, &queue->waitingConsumers, &queue->notEmpty);
+        return;
+    }
+    pthread_mutex_lock(&queue->lock);
+    atomic_fetch_add(&queue->waitingProducers, 1);
+    atomic_thread_fence(memory_order_seq_cst);
+    while (!tryEnqueueCell(queue, item)) {
+        pthread_cond_wait(&queue->notFull, &queue->lock);
+    }
+    atomic_fetch_sub(&queue->waitingProducers, 1);
+    pthread_mutex_unlock(&queue->lock);
+    wakeIfWaiting(queue, &queue->waitingConsumers, &queue->notEmpty);
+}
+
+void* mpmcDequeue(MPMCQueue* queue) {
+    if (queue == NULL) {
+        fprintf(stderr, "Error: MPMCQueue is NULL\n");
+        return NULL;
+    }
+    void* item = NULL;
+    if (tryDequeueCell(queue, &item)) {
+        wakeIfWaiting(queue, &queue->waitingProducers, &queue->notFull);
+        return item;
+    }
+    pthread_mutex_lock(&queue->lock);
+    atomic_fetch_add(&queue->waitingConsumers, 1);
+    atomic_thread_fence(memory_order_seq_cst);
+    while (!tryDequeueCell(queue, &item)) {
+        pthread_cond_wait(&queue->notEmpty, &queue->lock);
+    }
+    atomic_fetch_sub(&queue->waitingConsumers, 1);
+    pthread_mutex_unlock(&queue->lock);
+    wakeIfWaiting(queue, &queue->waitingProducers, &queue->notFull);
+    return item;
+}
+
+void freeMPMCQueue(MPMCQueue* queue) {
+    if (queue == NULL) return;
+    pthread_cond_destroy(&queue->notEmpty);
+    pthread_cond_destroy(&queue->notFull);
+    pthread_mutex_destroy(&queue->lock);
+    free(queue->buffer);
+    delete(queue);
+}
@@ -5,6 +5,52 @@
 #include <stdbool.h>
 #include <assert.h>
 
+static uint ringIndex(Queue* queue, uint offset) {
+    uint idx = queue->head + offset;
+    return idx >= queue->capacity ? idx - queue->capacity : idx;
+}
+
+static QueueStatus enqueueItem(Queue* queue, void* data) {
+    if (queue->ring != NULL) {
+        if (queue->size == queue->capacity) return QUEUE_FULL;
+        queue->ring[ringIndex(queue, queue->size)] = data;
+        queue->size++;
+        return QUEUE_OK;
+    }
+    SLLNode* newNode = SLL_poolAcquire(&queue->pool, data);
+    if (newNode == NULL) return QUEUE_ERROR;
+    if (queue->size == 0) {
+        queue->Front = newNode;
+        queue->Rear = newNode;
+    }
+    else {
+        queue->Rear->next = newNode;
+        queue->Rear = newNode;
+    }
+    queue->size++;
+    return QUEUE_OK;
+}
+
+// Caller guarantees the queue is non-empty.
+static void* dequeueItem(Queue* queue) {
+    void* data;
+    if (queue->ring != NULL) {
+        data = queue->ring[queue->head];
+        queue->head = ringIndex(queue, 1);
+    }
+    else {
+        SLLNode* frontNode = queue->Front;
+        data = frontNode->data;
+        queue->Front = frontNode->next;
+        if (queue->Front == NULL) {
+            queue->Rear = NULL;
+        }
+        SLL_poolRelease(&queue->pool, frontNode);
+    }
+    queue->size--;
+    return data;
+}
+
 /*      CONSTRUCTOR
  * ==================== */
 Queue* createQueue(void) {
@@ -16,9 +62,39 @@ Queue* createQueue(void) {
     queue->Front = NULL;
     queue->Rear = NULL;
     queue->size = 0;
+    queue->ring = NULL;
+    queue->capacity = 0;
+    queue->head = 0;
+    SLL_initNodePool(&queue->pool, QUEUE_NODE_SLAB, QUEUE_NODE_HIGH_WATER);
     return queue;
 }
 
+Queue* createQueueWithCapacity(uint capacity) {
+    if (capacity == 0) {
+        fprintf(stderr, "Error: Queue capacity must be greater than zero\n");
+        return NULL;
+    }
+    Queue* queue = createQueue();
+    if (queue == NULL) return NULL;
+    queue->ring = (void**)malloc(capacity * sizeof(void*));
+    if (queue->ring == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed for Queue storage\n");
+        delete(queue);
+        return NULL;
+    }
+    queue->capacity = capacity;
+    return queue;
+}
+
+void setQueueNodeCache(Queue* queue, uint slabSize, uint highWater) {
+    if (queue == NULL) {
+        fprintf(stderr, "Error: Queue is NULL\n");
+        return;
+    }
+    queue->pool.slabSize = slabSize > 0 ? slabSize : QUEUE_NODE_SLAB;
+    queue->pool.highWater = highWater;
+}
+
 
 /*      STATUS CHECKS
  * ==================== */
@@ -27,12 +103,15 @@ bool isQueueEmpty(Queue* queue) {
         fprintf(stderr, "Error: Queue is NULL\n");
         return true;
     }
-    return (queue->Front == NULL && queue->Rear == NULL);
+    return (queue->size == 0);
 }
 
 bool isQueueFull(Queue* queue) {
-    (void)queue;
-    return false;  // Linked implementation has no fixed capacity.
+    if (queue == NULL) {
+        fprintf(stderr, "Error: Queue is NULL\n");
+        return false;
+    }
+    return queue->ring != NULL && queue->size == queue->capacity;
 }
 
 uint getQueueSize(Queue* queue) {
@@ -51,21 +130,9 @@ void Enqueue(Queue* queue, void* data) {
         fprintf(stderr, "Error: Queue is NULL\n");
         return;
     }
-    SLLNode* newNode = createSLLNode(data);
-    if (newNode == NULL) {
-        fprintf(stderr, "Error: Memory allocation failed for new node\n");
-        return;
-    }
-    if (isQueueEmpty(queue)) {
-        queue->Front = newNode;
-        queue->Rear = newNode;
-    }
-    else {
-        queue->Rear->next = newNode;
-        queue->Rear = newNode;
+    if (enqueueItem(queue, data) == QUEUE_FULL) {
+        fprintf(stderr, "Error: Queue is full\n");
     }
-    queue->size++;
-    newNode->next = NULL;
 }
 
 void* Dequeue(Queue* queue) {
@@ -77,15 +144,7 @@ void* Dequeue(Queue* queue) {
         fprintf(stderr, "Error: Queue is empty\n");
         return NULL;
     }
-    SLLNode* frontNode = queue->Front;
-    void* data = frontNode->data;
-    queue->Front = frontNode->next;
-    if (queue->Front == NULL) {
-        queue->Rear = NULL;
-    }
-    delete(frontNode);
-    queue->size--;
-    return data;
+    return dequeueItem(queue);
 }
 
 void* Queue_Peek(Queue* queue) {
@@ -97,9 +156,81 @@ void* Queue_Peek(Queue* queue) {
         fprintf(stderr, "Error: Queue is empty\n");
         return NULL;
     }
+    if (queue->ring != NULL) return queue->ring[queue->head];
     return queue->Front->data;
 }
 
+QueueStatus tryEnqueue(Queue* queue, void* data) {
+    if (queue == NULL) return QUEUE_ERROR;
+    return enqueueItem(queue, data);
+}
+
+QueueStatus tryDequeue(Queue* queue, void** out) {
+    if (queue == NULL || out == NULL) return QUEUE_ERROR;
+    if (queue->size == 0) return QUEUE_EMPTY;
+    *out = dequeueItem(queue);
+    return QUEUE_OK;
+}
+
+uint EnqueueMany(Queue* queue, void** items, uint count) {
+    if (queue == NULL || items == NULL) {
+        fprintf(stderr, "Error: Queue or items array is NULL\n");
+        return 0;
+    }
+    if (count == 0) return 0;
+    if (queue->ring != NULL) {
+        if (count > queue->capacity - queue->size) count = queue->capacity - queue->size;
+        uint tail = ringIndex(queue, queue->size);
+        uint firstPart = queue->capacity - tail;
+        if (firstPart > count) firstPart = count;
+        memcpy(queue->ring + tail, items, firstPart * sizeof(void*));
+        memcpy(queue->ring, items + firstPart, (count - firstPart) * sizeof(void*));
+        queue->size += count;
+        return count;
+    }
+    // Build the run off to the side, then splice it onto the rear once.
+    if (!SLL_poolReserve(&queue->pool, count)) return 0;
+    SLLNode* first = SLL_poolAcquire(&queue->pool, items[0]);
+    SLLNode* last = first;
+    for (uint i = 1; i < count; i++) {
+        last->next = SLL_poolAcquire(&queue->pool, items[i]);
+        last = last->next;
+    }
+    if (queue->size == 0) queue->Front = first;
+    else queue->Rear->next = first;
+    queue->Rear = last;
+    queue->size += count;
+    return count;
+}
+
+uint DequeueMany(Queue* queue, void** out, uint max) {
+    if (queue == NULL || out == NULL) {
+        fprintf(stderr, "Error: Queue or output array is NULL\n");
+        return 0;
+    }
+    uint count = max < queue->size ? max : queue->size;
+    if (queue->ring != NULL) {
+        uint firstPart = queue->capacity - queue->head;
+        if (firstPart > count) firstPart = count;
+        memcpy(out, queue->ring + queue->head, firstPart * sizeof(void*));
+        memcpy(out + firstPart, queue->ring, (count - firstPart) * sizeof(void*));
+        queue->head = ringIndex(queue, count);
+        queue->size -= count;
+        return count;
+    }
+    SLLNode* current = queue->Front;
+    for (uint i = 0; i < count; i++) {
+        SLLNode* next = current->next;
+        out[i] = current->data;
+        SLL_poolRelease(&queue->pool, current);
+        current = next;
+    }
+    queue->Front = current;
+    if (current == NULL) queue->Rear = NULL;
+    queue->size -= count;
+    return count;
+}
+
 
 /*  DEALOC AND DESTRUCT
  * ==================== */
@@ -114,6 +245,7 @@ void clearQueue(Queue* queue) {
     queue->Front = NULL;
     queue->Rear = NULL;
     queue->size = 0;
+    queue->head = 0;
 }
 
 void freeQueue(Queue* queue) {
@@ -122,6 +254,8 @@ void freeQueue(Queue* queue) {
         return;
     }
     clearQueue(queue);
+    SLL_destroyNodePool(&queue->pool);
+    free(queue->ring);
     delete(queue);
 }
 
@@ -133,6 +267,13 @@ void printQueue(Queue* queue, void (*printFunc)(void*)) {
         fprintf(stderr, "Error: Queue is NULL\n");
         return;
     }
+    if (queue->ring != NULL) {
+        for (uint i = 0; i < queue->size; i++) {
+            printFunc(queue->ring[ringIndex(queue, i)]);
+        }
+        printf("\n");
+        return;
+    }
     SLLNode* current = queue->Front;
     while (current != NULL) {
         printFunc(current->data);
@@ -152,6 +293,13 @@ void printQueueReverse(Queue* queue, void (*printFunc)(void*)) {
         fprintf(stderr, "Error: Queue is NULL\n");
         return;
     }
+    if (queue->ring != NULL) {
+        for (uint i = queue->size; i > 0; i--) {
+            printFunc(queue->ring[ringIndex(queue, i - 1)]);
+        }
+        printf("\n");
+        return;
+    }
     printQueueReverseRecursive(queue->Front, printFunc);
     printf("\n");
 }
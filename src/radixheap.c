@@ -0,0 +1,179 @@
+#include "radixheap.h"
+#include <stdio.h>
+
+#define DEFAULT_BUCKET_CAPACITY 16
+
+static size_t bucketIndex(uint64_t key, uint64_t last) {
+    uint64_t diff = key ^ last;
+    if (diff == 0) return 0;
+#if defined(__GNUC__) || defined(__clang__)
+    return (size_t)(64 - __builtin_clzll(diff));
+#else
+    size_t bits = 0;
+    while (diff != 0) {
+        diff >>= 1;
+        bits++;
+    }
+    return bits;
+#endif
+}
+
+static bool bucketReserve(RadixHeapBucket* bucket, size_t needed) {
+    if (needed <= bucket->capacity) return true;
+    size_t newCapacity = bucket->capacity == 0 ? DEFAULT_BUCKET_CAPACITY : bucket->capacity;
+    while (newCapacity < needed) newCapacity *= 2;
+    RadixHeapEntry* resized = (RadixHeapEntry*)realloc(bucket->data, newCapacity * sizeof(RadixHeapEntry));
+    if (resized == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed while growing radix heap bucket\n");
+        return false;
+    }
+    bucket->data = resized;
+    bucket->capacity = newCapacity;
+    return true;
+}
+
+// Make bucket 0 non-empty: move `last` up to the smallest key of the first
+// non-empty bucket and redistribute that bucket. Every entry only ever moves
+// to a strictly lower bucket, which gives the amortized O(log C) bound.
+static bool pull(RadixHeap* heap) {
+    if (heap->buckets[0].size > 0) return true;
+    size_t i = 1;
+    while (heap->buckets[i].size == 0) i++;
+
+    RadixHeapBucket* bucket = &heap->buckets[i];
+    uint64_t minKey = bucket->data[0].key;
+    for (size_t j = 1; j < bucket->size; j++) {
+        if (bucket->data[j].key < minKey) minKey = bucket->data[j].key;
+    }
+
+    // Reserve every target first so a failed allocation loses nothing.
+    size_t counts[RADIXHEAP_BUCKETS] = {0};
+    for (size_t j = 0; j < bucket->size; j++) {
+        counts[bucketIndex(bucket->data[j].key, minKey)]++;
+    }
+    for (size_t b = 0; b < i; b++) {
+        if (counts[b] > 0 && !bucketReserve(&heap->buckets[b], heap->buckets[b].size + counts[b])) {
+            return false;
+        }
+    }
+
+    heap->last = minKey;
+    for (size_t j = 0; j < bucket->size; j++) {
+        RadixHeapBucket* target = &heap->buckets[bucketIndex(bucket->data[j].key, minKey)];
+        target->data[target->size++] = bucket->data[j];
+    }
+    bucket->size = 0;
+    return true;
+}
+
+RadixHeap* createRadixHeap(void) {
+    RadixHeap* heap = new(RadixHeap);
+    if (heap == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed for RadixHeap\n");
+        return NULL;
+    }
+    for (size_t i = 0; i < RADIXHEAP_BUCKETS; i++) {
+        heap->buckets[i].data = NULL;
+        heap->buckets[i].size = 0;
+        heap->buckets[i].capacity = 0;
+    }
+    heap->last = 0;
+    heap->size = 0;
+    return heap;
+}
+
+bool radixHeapIsEmpty(RadixHeap* heap) {
+    if (heap == NULL) {
+        fprintf(stderr, "Error: RadixHeap is NULL\n");
+        return true;
+    }
+    return heap->size == 0;
+}
+
+size_t radixHeapSize(RadixHeap* heap) {
+    if (heap == NULL) {
+        fprintf(stderr, "Error: RadixHeap is NULL\n");
+        return 0;
+    }
+    return heap->size;
+}
+
+bool radixHeapPush(RadixHeap* heap, uint64_t key, void* item) {
+    if (heap == NULL) {
+        fprintf(stderr, "Error: RadixHeap is NULL\n");
+        return false;
+    }
+    if (key < heap->last) {
+        fprintf(stderr, "Error: RadixHeap key is below the last popped key\n");
+        return false;
+    }
+    RadixHeapBucket* bucket = &heap->buckets[bucketIndex(key, heap->last)];
+    if (!bucketReserve(bucket, bucket->size + 1)) return false;
+    bucket->data[bucket->size].key = key;
+    bucket->data[bucket->size].item = item;
+    bucket->size++;
+    heap->size++;
+    return true;
+}
+
+void* radixHeapPop(RadixHeap* heap, uint64_t* key) {
+    if (heap == NULL) {
+        fprintf(stderr, "Error: RadixHeap is NULL\n");
+        return NULL;
+    }
+    if (heap->size == 0) {
+        fprintf(stderr, "Error: RadixHeap is empty\n");
+        return NULL;
+    }
+    if (!pull(heap)) return NULL;
+    RadixHeapBucket* bucket = &heap->buckets[0];
+    RadixHeapEntry* entry = &bucket->data[--bucket->size];
+    heap->size--;
+    if (key != NULL) *key = entry->key;
+    return entry->item;
+}
+
+void* radixHeapPeek(RadixHeap* heap, uint64_t* key) {
+    if (heap == NULL) {
+        fprintf(stderr, "Error: RadixHeap is NULL\n");
+        return NULL;
+    }
+    if (heap->size == 0) {
+        fprintf(stderr, "Error: RadixHeap is empty\n");
+        return NULL;
+    }
+    // Scan instead of pull(): redistributing would move `last` and tighten
+    // the push bound before anything is actually popped. The last minimal
+    // entry is the one pull() would leave on top of bucket 0 for pop.
+    size_t i = 0;
+    while (heap->buckets[i].size == 0) i++;
+    RadixHeapBucket* bucket = &heap->buckets[i];
+    RadixHeapEntry* entry = &bucket->data[bucket->size - 1];
+    if (i > 0) {
+        for (size_t j = 0; j < bucket->size; j++) {
+            if (bucket->data[j].key <= entry->key) entry = &bucket->data[j];
+        }
+    }
+    if (key != NULL) *key = entry->key;
+    return entry->item;
+}
+
+void clearRadixHeap(RadixHeap* heap) {
+    if (heap == NULL) {
+        fprintf(stderr, "Error: RadixHeap is NULL\n");
+        return;
+    }
+    for (size_t i = 0; i < RADIXHEAP_BUCKETS; i++) {
+        heap->buckets[i].size = 0;
+    }
+    heap->last = 0;
+    heap->size = 0;
+}
+
+void freeRadixHeap(RadixHeap* heap) {
+    if (heap == NULL) return;
+    for (size_t i = 0; i < RADIXHEAP_BUCKETS; i++) {
+        free(heap->buckets[i].data);
+    }
+    delete(heap);
+}
@@ -0,0 +1,278 @@
+#include "skiplist.h"
+#include <stdio.h>
+
+// Positions are ranked from 1, with the head sentinel at rank 0. A link's
+// width is the rank difference to its next node; links to NULL carry no
+// meaningful width.
+
+static SkipListNode* createSkipListNode(void* data, int level) {
+    SkipListNode* node = (SkipListNode*)malloc(sizeof(SkipListNode) + level * sizeof(SkipLink));
+    if (node == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed for SkipListNode\n");
+        return NULL;
+    }
+    node->data = data;
+    node->prev = NULL;
+    node->level = level;
+    for (int i = 0; i < level; i++) {
+        node->links[i].next = NULL;
+        node->links[i].width = 0;
+    }
+    return node;
+}
+
+// Geometric level with p = 1/4, two random bits per step.
+static int randomLevel(IndexedSkipList* list) {
+    uint32_t x = list->seed;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    list->seed = x;
+    int level = 1;
+    while ((x & 3) == 0 && level < SKIPLIST_MAX_LEVEL) {
+        level++;
+        x >>= 2;
+    }
+    return level;
+}
+
+// Fill update[]/rank[] with the last node before rank at every level in use.
+static void findPredecessors(IndexedSkipList* list, int rank, SkipListNode** update, int* ranks) {
+    SkipListNode* x = list->head;
+    int current = 0;
+    for (int lvl = list->level - 1; lvl >= 0; lvl--) {
+        while (x->links[lvl].next != NULL && current + x->links[lvl].width < rank) {
+            current += x->links[lvl].width;
+            x = x->links[lvl].next;
+        }
+        update[lvl] = x;
+        ranks[lvl] = current;
+    }
+}
+
+/*      CONSTRUCTOR
+ * ==================== */
+IndexedSkipList* createIndexedSkipList(void) {
+    IndexedSkipList* list = new(IndexedSkipList);
+    if (list == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed for IndexedSkipList\n");
+        return NULL;
+    }
+    list->head = createSkipListNode(NULL, SKIPLIST_MAX_LEVEL);
+    if (list->head == NULL) {
+        delete(list);
+        return NULL;
+    }
+    list->tail = NULL;
+    list->size = 0;
+    list->level = 1;
+    list->seed = 0x9E3779B9u;
+    return list;
+}
+
+/*     INSERT NODE
+ * ==================== */
+void ISL_insertFront(IndexedSkipList* list, void* data) {
+    ISL_insertNode(list, data, 0);
+}
+
+void ISL_insertBack(IndexedSkipList* list, void* data) {
+    if (list == NULL) {
+        fprintf(stderr, "Error: List is NULL\n");
+        return;
+    }
+    ISL_insertNode(list, data, list->size);
+}
+
+void ISL_insertNode(IndexedSkipList* list, void* data, int pos) {
+    if (list == NULL) {
+        fprintf(stderr, "Error: List is NULL\n");
+        return;
+    }
+    if (pos < 0 || pos > list->size) {
+        fprintf(stderr, "Error: Invalid position for insertion\n");
+        return;
+    }
+    int level = randomLevel(list);
+    SkipListNode* node = createSkipListNode(data, level);
+    if (node == NULL) return;
+
+    SkipListNode* update[SKIPLIST_MAX_LEVEL];
+    int ranks[SKIPLIST_MAX_LEVEL];
+    int rank = pos + 1;
+    for (int lvl = list->level; lvl < level; lvl++) {
+        update[lvl] = list->head;
+        ranks[lvl] = 0;
+    }
+    findPredecessors(list, rank, update, ranks);
+    if (level > list->level) list->level = level;
+
+    for (int lvl = 0; lvl < list->level; lvl++) {
+        SkipLink* link = &update[lvl]->links[lvl];
+        if (lvl < level) {
+            node->links[lvl].next = link->next;
+            // Old span was ranks[lvl] -> ranks[lvl] + width; its end shifts by one.
+            if (link->next != NULL) node->links[lvl].width = ranks[lvl] + link->width + 1 - rank;
+            link->next = node;
+            link->width = rank - ranks[lvl];
+        }
+        else if (link->next != NULL) {
+            link->width++;
+        }
+    }
+    node->prev = (update[0] == list->head) ? NULL : update[0];
+    if (node->links[0].next != NULL) node->links[0].next->prev = node;
+    else list->tail = node;
+    list->size++;
+}
+
+/*     REMOVE NODE
+ * ==================== */
+void* ISL_removeFront(IndexedSkipList* list) {
+    if (list == NULL || list->size == 0) {
+        fprintf(stderr, "Error: List is NULL or empty\n");
+        return NULL;
+    }
+    return ISL_removeNode(list, 0);
+}
+
+void* ISL_removeBack(IndexedSkipList* list) {
+    if (list == NULL || list->size == 0) {
+        fprintf(stderr, "Error: List is NULL or empty\n");
+        return NULL;
+    }
+    return ISL_removeNode(list, list->size - 1);
+}
+
+void* ISL_removeNode(IndexedSkipList* list, int pos) {
+    if (list == NULL) {
+        fprintf(stderr, "Error: List is NULL\n");
+        return NULL;
+    }
+    if (pos < 0 || pos >= list->size) {
+        fprintf(stderr, "Error: Invalid position for removal\n");
+        return NULL;
+    }
+    SkipListNode* update[SKIPLIST_MAX_LEVEL];
+    int ranks[SKIPLIST_MAX_LEVEL];
+    findPredecessors(list, pos + 1, update, ranks);
+    SkipListNode* target = update[0]->links[0].next;
+
+    for (int lvl = 0; lvl < list->level; lvl++) {
+        SkipLink* link = &update[lvl]->links[lvl];
+        if (link->next == target) {
+            link->next = target->links[lvl].next;
+            link->width += target->links[lvl].width - 1;
+        }
+        else if (link->next != NULL) {
+            link->width--;
+        }
+    }
+    if (target->links[0].next != NULL) target->links[0].next->prev = target->prev;
+    else list->tail = target->prev;
+    while (list->level > 1 && list->head->links[list->level - 1].next == NULL) list->level--;
+
+    void* data = target->data;
+    free(target);
+    list->size--;
+    return data;
+}
+
+/*       GET NODE
+ * ==================== */
+void* ISL_getFront(IndexedSkipList* list) {
+    if (list == NULL || list->size == 0) {
+        fprintf(stderr, "Error: List is NULL or empty\n");
+        return NULL;
+    }
+    return list->head->links[0].next->data;
+}
+
+void* ISL_getBack(IndexedSkipList* list) {
+    if (list == NULL || list->size == 0) {
+        fprintf(stderr, "Error: List is NULL or empty\n");
+        return NULL;
+    }
+    return list->tail->data;
+}
+
+void* ISL_getNode(IndexedSkipList* list, int pos) {
+    if (list == NULL) {
+        fprintf(stderr, "Error: List is NULL\n");
+        return NULL;
+    }
+    if (pos < 0 || pos >= list->size) {
+        fprintf(stderr, "Error: Invalid position for retrieval\n");
+        return NULL;
+    }
+    int rank = pos + 1;
+    SkipListNode* x = list->head;
+    int current = 0;
+    for (int lvl = list->level - 1; lvl >= 0; lvl--) {
+        while (x->links[lvl].next != NULL && current + x->links[lvl].width <= rank) {
+            current += x->links[lvl].width;
+            x = x->links[lvl].next;
+        }
+        if (current == rank) break;
+    }
+    return x->data;
+}
+
+/*       ITERATION
+ * ==================== */
+SkipListNode* ISL_firstNode(IndexedSkipList* list) {
+    if (list == NULL) {
+        fprintf(stderr, "Error: List is NULL\n");
+        return NULL;
+    }
+    return list->head->links[0].next;
+}
+
+SkipListNode* ISL_nextNode(SkipListNode* node) {
+    if (node == NULL) return NULL;
+    return node->links[0].next;
+}
+
+/*  DEALOC AND DESTRUCT
+ * ==================== */
+void ISL_clearList(IndexedSkipList* list) {
+    if (list == NULL) {
+        fprintf(stderr, "Error: List is NULL\n");
+        return;
+    }
+    SkipListNode* current = list->head->links[0].next;
+    while (current != NULL) {
+        SkipListNode* next = current->links[0].next;
+        free(current);
+        current = next;
+    }
+    for (int i = 0; i < SKIPLIST_MAX_LEVEL; i++) {
+        list->head->links[i].next = NULL;
+        list->head->links[i].width = 0;
+    }
+    list->tail = NULL;
+    list->size = 0;
+    list->level = 1;
+}
+
+void ISL_freeList(IndexedSkipList* list) {
+    if (list == NULL) {
+        fprintf(stderr, "Error: List is NULL\n");
+        return;
+    }
+    ISL_clearList(list);
+    free(list->head);
+    delete(list);
+}
+
+/*      PRINT LIST
+ * ==================== */
+void ISL_printList(IndexedSkipList* list, void (*printFunc)(void*)) {
+    if (list == NULL) {
+        fprintf(stderr, "Error: List is NULL\n");
+        return;
+    }
+    for (SkipListNode* node = list->head->links[0].next; node != NULL; node = node->links[0].next) {
+        printFunc(node->data);
+    }
+}
@@ -0,0 +1,140 @@
+#include "spscqueue.h"
+#include <stdio.h>
+#include <string.h>
+
+// Each side owns its index and only reads the other side's index when its
+// cached copy says the ring looks full (producer) or empty (consumer). In
+// steady state that keeps the remote cache line out of the hot path.
+
+static void copyOut(SPSCQueue* queue, size_t start, void** out, size_t count) {
+    size_t idx = start & queue->mask;
+    size_t first = queue->mask + 1 - idx;
+    if (first > count) first = count;
+    memcpy(out, queue->buffer + idx, first * sizeof(void*));
+    memcpy(out + first, queue->buffer, (count - first) * sizeof(void*));
+}
+
+static void copyIn(SPSCQueue* queue, size_t start, void** items, size_t count) {
+    size_t idx = start & queue->mask;
+    size_t first = queue->mask + 1 - idx;
+    if (first > count) first = count;
+    memcpy(queue->buffer + idx, items, first * sizeof(void*));
+    memcpy(queue->buffer, items + first, (count - first) * sizeof(void*));
+}
+
+SPSCQueue* createSPSCQueue(size_t capacity) {
+    if (capacity == 0) {
+        fprintf(stderr, "Error: SPSCQueue capacity must be greater than zero\n");
+        return NULL;
+    }
+    size_t rounded = 1;
+    while (rounded < capacity) rounded <<= 1;
+    SPSCQueue* queue = new(SPSCQueue);
+    if (queue == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed for SPSCQueue\n");
+        return NULL;
+    }
+    queue->buffer = (void**)malloc(rounded * sizeof(void*));
+    if (queue->buffer == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed for SPSCQueue storage\n");
+        delete(queue);
+        return NULL;
+    }
+    queue->mask = rounded - 1;
+    atomic_init(&queue->head, 0);
+    atomic_init(&queue->tail, 0);
+    queue->cachedTail = 0;
+    queue->cachedHead = 0;
+    return queue;
+}
+
+size_t spscCapacity(SPSCQueue* queue) {
+    if (queue == NULL) {
+        fprintf(stderr, "Error: SPSCQueue is NULL\n");
+        return 0;
+    }
+    return queue->mask + 1;
+}
+
+size_t spscSize(SPSCQueue* queue) {
+    if (queue == NULL) {
+        fprintf(stderr, "Error: SPSCQueue is NULL\n");
+        return 0;
+    }
+    size_t head = atomic_load_explicit(&queue->head, memory_order_acquire);
+    size_t tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+    return tail - head;
+}
+
+bool spscEnqueue(SPSCQueue* queue, void* item) {
+    if (queue == NULL) {
+        fprintf(stderr, "Error: SPSCQueue is NULL\n");
+        return false;
+    }
+    size_t tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+    if (tail - queue->cachedHead > queue->mask) {
+        queue->cachedHead = atomic_load_explicit(&queue->head, memory_order_acquire);
+        if (tail - queue->cachedHead > queue->mask) return false;
+    }
+    queue->buffer[tail & queue->mask] = item;
+    atomic_store_explicit(&queue->tail, tail + 1, memory_order_release);
+    return true;
+}
+
+bool spscDequeue(SPSCQueue* queue, void** out) {
+    if (queue == NULL || out == NULL) {
+        fprintf(stderr, "Error: SPSCQueue or output is NULL\n");
+        return false;
+    }
+    size_t head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+    if (head == queue->cachedTail) {
+        queue->cachedTail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+        if (head == queue->cachedTail) return false;
+    }
+    *out = queue->buffer[head & queue->mask];
+    atomic_store_explicit(&queue->head, head + 1, memory_order_release);
+    return true;
+}
+
+size_t spscEnqueueMany(SPSCQueue* queue, void** items, size_t count) {
+    if (queue == NULL || items == NULL) {
+        fprintf(stderr, "Error: SPSCQueue or items array is NULL\n");
+        return 0;
+    }
+    size_t tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+    size_t capacity = queue->mask + 1;
+    size_t space = capacity - (tail - queue->cachedHead);
+    if (space < count) {
+        queue->cachedHead = atomic_load_explicit(&queue->head, memory_order_acquire);
+        space = capacity - (tail - queue->cachedHead);
+    }
+    if (count > space) count = space;
+    if (count == 0) return 0;
+    copyIn(queue, tail, items, count);
+    atomic_store_explicit(&queue->tail, tail + count, memory_order_release);
+    return count;
+}
+
+size_t spscDequeueMany(SPSCQueue* queue, void** out, size_t max) {
+    if (queue == NULL || out == NULL) {
+        fprintf(stderr, "Error: SPSCQueue or output is NULL\n");
+        return 0;
+    }
+    size_t head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+    size_t available = queue->cachedTail - head;
+    if (available < max) {
+        queue->cachedTail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+        available = queue->cachedTail - head;
+    }
+    if (max > available) max = available;
+    if (max == 0) return 0;
+    copyOut(queue, head, out, max);
+    atomic_store_explicit(&queue->head, head + max, memory_order_release);
+    return max;
+}
+
+void freeSPSCQueue(SPSCQueue* queue) {
+    if (queue == NULL) return;
+    free(queue->buffer);
+    delete(queue);
+}
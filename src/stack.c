@@ -5,19 +5,68 @@
 #include <stdbool.h>
 #include <assert.h>
 
+#define DEFAULT_STACK_CAPACITY 16
+#define SHRINK_DIVISOR 4
+
+static bool resizeStack(Stack* stack, uint newCapacity) {
+    void** resized = (void**)realloc(stack->data, newCapacity * sizeof(void*));
+    if (resized == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed while resizing stack\n");
+        return false;
+    }
+    stack->data = resized;
+    stack->capacity = newCapacity;
+    return true;
+}
+
+// Grow geometrically so that `needed` elements fit, never past the cap.
+static bool ensureStackCapacity(Stack* stack, uint needed) {
+    if (needed <= stack->capacity) return true;
+    uint newCapacity = stack->capacity;
+    while (newCapacity < needed) newCapacity *= 2;
+    if (stack->maxCapacity != 0 && newCapacity > stack->maxCapacity) {
+        newCapacity = stack->maxCapacity;
+    }
+    return resizeStack(stack, newCapacity);
+}
+
+// Halve storage once usage drops below a quarter, so alternating push/pop
+// around the boundary cannot thrash the allocator.
+static void shrinkStack(Stack* stack) {
+    uint floor = stack->reserved > DEFAULT_STACK_CAPACITY ? stack->reserved : DEFAULT_STACK_CAPACITY;
+    if (stack->capacity <= floor) return;
+    if (stack->size >= stack->capacity / SHRINK_DIVISOR) return;
+    uint newCapacity = stack->capacity / 2;
+    if (newCapacity < floor) newCapacity = floor;
+    resizeStack(stack, newCapacity);
+}
+
 /*      CONSTRUCTOR
  * ==================== */
-Stack* createStack(void) {
+Stack* createStackWithCapacity(uint capacity) {
     Stack* stack = new(Stack);
     if (stack == NULL) {
         fprintf(stderr, "Error: Memory allocation failed for Stack\n");
         return NULL;
     }
-    stack->Top = NULL;
+    stack->maxCapacity = capacity;
+    stack->reserved = 0;
+    stack->capacity = DEFAULT_STACK_CAPACITY;
+    if (capacity != 0 && capacity < stack->capacity) stack->capacity = capacity;
     stack->size = 0;
+    stack->data = (void**)malloc(stack->capacity * sizeof(void*));
+    if (stack->data == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed for Stack storage\n");
+        delete(stack);
+        return NULL;
+    }
     return stack;
 }
 
+Stack* createStack(void) {
+    return createStackWithCapacity(0);
+}
+
 
 /*      STATUS CHECKS
  * ==================== */
@@ -26,12 +75,15 @@ bool isStackEmpty(Stack* stack) {
         fprintf(stderr, "Error: Stack is NULL\n");
         return true;
     }
-    return (stack->Top == NULL);
+    return (stack->size == 0);
 }
 
 bool isStackFull(Stack* stack) {
-    (void)stack;
-    return false;  // Linked implementation is effectively unbounded.
+    if (stack == NULL) {
+        fprintf(stderr, "Error: Stack is NULL\n");
+        return false;
+    }
+    return stack->maxCapacity != 0 && stack->size >= stack->maxCapacity;
 }
 
 uint getStackSize(Stack* stack) {
@@ -50,16 +102,12 @@ void push(Stack* stack, void* data) {
         fprintf(stderr, "Error: Stack is NULL\n");
         return;
     }
-
-    SLLNode* newNode = createSLLNode(data);
-    if (newNode == NULL) {
-        fprintf(stderr, "Error: Memory allocation failed for new node\n");
+    if (isStackFull(stack)) {
+        fprintf(stderr, "Error: Stack is full\n");
         return;
     }
-
-    newNode->next = stack->Top;
-    stack->Top = newNode;
-    stack->size++;
+    if (!ensureStackCapacity(stack, stack->size + 1)) return;
+    stack->data[stack->size++] = data;
 }
 
 void* pop(Stack* stack) {
@@ -71,13 +119,8 @@ void* pop(Stack* stack) {
         fprintf(stderr, "Error: Stack is empty\n");
         return NULL;
     }
-
-    SLLNode* topNode = stack->Top;
-    void* data = topNode->data;
-    stack->Top = topNode->next;
-    delete(topNode);
-    stack->size--;
-
+    void* data = stack->data[--stack->size];
+    shrinkStack(stack);
     return data;
 }
 
@@ -90,7 +133,46 @@ void* Stack_Peek(Stack* stack) {
         fprintf(stderr, "Error: Stack is empty\n");
         return NULL;
     }
-    return stack->Top->data;
+    return stack->data[stack->size - 1];
+}
+
+bool stackReserve(Stack* stack, uint capacity) {
+    if (stack == NULL) {
+        fprintf(stderr, "Error: Stack is NULL\n");
+        return false;
+    }
+    if (stack->maxCapacity != 0 && capacity > stack->maxCapacity) capacity = stack->maxCapacity;
+    stack->reserved = capacity;
+    if (capacity <= stack->capacity) return true;
+    return resizeStack(stack, capacity);
+}
+
+uint pushMany(Stack* stack, void** items, uint count) {
+    if (stack == NULL || items == NULL) {
+        fprintf(stderr, "Error: Stack or items array is NULL\n");
+        return 0;
+    }
+    if (stack->maxCapacity != 0 && count > stack->maxCapacity - stack->size) {
+        count = stack->maxCapacity - stack->size;
+    }
+    if (!ensureStackCapacity(stack, stack->size + count)) return 0;
+    memcpy(stack->data + stack->size, items, count * sizeof(void*));
+    stack->size += count;
+    return count;
+}
+
+uint popMany(Stack* stack, void** out, uint max) {
+    if (stack == NULL || out == NULL) {
+        fprintf(stderr, "Error: Stack or output array is NULL\n");
+        return 0;
+    }
+    uint count = max < stack->size ? max : stack->size;
+    for (uint i = 0; i < count; i++) {
+        out[i] = stack->data[stack->size - 1 - i];
+    }
+    stack->size -= count;
+    shrinkStack(stack);
+    return count;
 }
 
 
@@ -101,10 +183,8 @@ void clearStack(Stack* stack) {
         fprintf(stderr, "Error: Stack is NULL\n");
         return;
     }
-
-    while (!isStackEmpty(stack)) {
-        pop(stack);
-    }
+    stack->size = 0;
+    shrinkStack(stack);
 }
 
 void freeStack(Stack* stack) {
@@ -112,7 +192,7 @@ void freeStack(Stack* stack) {
         fprintf(stderr, "Error: Stack is NULL\n");
         return;
     }
-    clearStack(stack);
+    free(stack->data);
     delete(stack);
 }
 
@@ -124,25 +204,19 @@ void printStack(Stack* stack, void (*printFunc)(void*)) {
         fprintf(stderr, "Error: Stack is NULL\n");
         return;
     }
-    SLLNode* current = stack->Top;
-    while (current != NULL) {
-        printFunc(current->data);
-        current = current->next;
+    for (uint i = stack->size; i > 0; i--) {
+        printFunc(stack->data[i - 1]);
     }
     printf("\n");
 }
 
-static void printStackReverseRecursive(SLLNode* node, void (*printFunc)(void*)) {
-    if (node == NULL) return;
-    printStackReverseRecursive(node->next, printFunc);
-    printFunc(node->data);
-}
-
 void printStackReverse(Stack* stack, void (*printFunc)(void*)) {
     if (stack == NULL) {
         fprintf(stderr, "Error: Stack is NULL\n");
         return;
     }
-    printStackReverseRecursive(stack->Top, printFunc);
+    for (uint i = 0; i < stack->size; i++) {
+        printFunc(stack->data[i]);
+    }
     printf("\n");
 }
@@ -0,0 +1,205 @@
+#include "timerwheel.h"
+#include <stdio.h>
+
+#define SLOT_MASK ((uint64_t)TIMERWHEEL_SLOTS - 1)
+#define WHEEL_SPAN ((uint64_t)1 << (TIMERWHEEL_SLOT_BITS * TIMERWHEEL_LEVELS))
+
+// Slot lists reuse DoublyLinkedList/DLLNode, but nodes are embedded in the
+// timer so linking never allocates and unlinking never frees.
+static void slotAppend(DoublyLinkedList* list, DLLNode* node) {
+    node->next = NULL;
+    node->prev = list->tail;
+    if (list->tail != NULL) {
+        list->tail->next = node;
+    } else {
+        list->head = node;
+    }
+    list->tail = node;
+    list->size++;
+}
+
+static void slotUnlink(DoublyLinkedList* list, DLLNode* node) {
+    if (node->prev != NULL) {
+        node->prev->next = node->next;
+    } else {
+        list->head = node->next;
+    }
+    if (node->next != NULL) {
+        node->next->prev = node->prev;
+    } else {
+        list->tail = node->prev;
+    }
+    node->next = NULL;
+    node->prev = NULL;
+    list->size--;
+}
+
+static void slotDetach(DoublyLinkedList* list, DoublyLinkedList* out) {
+    *out = *list;
+    list->head = NULL;
+    list->tail = NULL;
+    list->size = 0;
+    for (DLLNode* node = out->head; node != NULL; node = node->next) {
+        ((TimerWheelTimer*)node->data)->slot = out;
+    }
+}
+
+static void placeTimer(TimerWheel* wheel, TimerWheelTimer* timer) {
+    uint64_t expires = timer->expires;
+    if (expires < wheel->current) expires = wheel->current;
+    uint64_t delta = expires - wheel->current;
+    if (delta >= WHEEL_SPAN) {
+        // Park in the outermost level; it is re-placed when that slot cascades.
+        expires = wheel->current + WHEEL_SPAN - 1;
+        delta = WHEEL_SPAN - 1;
+    }
+    uint32_t level = 0;
+    while (level + 1 < TIMERWHEEL_LEVELS &&
+           delta >= ((uint64_t)1 << (TIMERWHEEL_SLOT_BITS * (level + 1)))) {
+        level++;
+    }
+    size_t idx = (size_t)((expires >> (TIMERWHEEL_SLOT_BITS * level)) & SLOT_MASK);
+    timer->slot = &wheel->slots[level][idx];
+    slotAppend(timer->slot, &timer->link);
+}
+
+static void cascade(TimerWheel* wheel, uint32_t level, size_t idx) {
+    DoublyLinkedList batch;
+    slotDetach(&wheel->slots[level][idx], &batch);
+    while (batch.head != NULL) {
+        DLLNode* node = batch.head;
+        slotUnlink(&batch, node);
+        placeTimer(wheel, (TimerWheelTimer*)node->data);
+    }
+}
+
+TimerWheel* createTimerWheel(uint64_t now) {
+    TimerWheel* wheel = new(TimerWheel);
+    if (wheel == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed for TimerWheel\n");
+        return NULL;
+    }
+    for (uint32_t level = 0; level < TIMERWHEEL_LEVELS; level++) {
+        for (size_t i = 0; i < TIMERWHEEL_SLOTS; i++) {
+            wheel->slots[level][i].head = NULL;
+            wheel->slots[level][i].tail = NULL;
+            wheel->slots[level][i].size = 0;
+            wheel->slots[level][i].cursor = NULL;
+            wheel->slots[level][i].cursorIndex = 0;
+        }
+    }
+    wheel->current = now;
+    wheel->size = 0;
+    return wheel;
+}
+
+void initTimer(TimerWheelTimer* timer, TimerCallback callback, void* arg) {
+    if (timer == NULL) {
+        fprintf(stderr, "Error: TimerWheelTimer is NULL\n");
+        return;
+    }
+    timer->link.data = timer;
+    timer->link.next = NULL;
+    timer->link.prev = NULL;
+    timer->slot = NULL;
+    timer->expires = 0;
+    timer->callback = callback;
+    timer->arg = arg;
+}
+
+bool timerIsPending(TimerWheelTimer* timer) {
+    if (timer == NULL) return false;
+    return timer->slot != NULL;
+}
+
+bool timerWheelSchedule(TimerWheel* wheel, TimerWheelTimer* timer, uint64_t expires) {
+    if (wheel == NULL || timer == NULL) {
+        fprintf(stderr, "Error: TimerWheel or timer is NULL\n");
+        return false;
+    }
+    if (timer->slot != NULL) {
+        slotUnlink(timer->slot, &timer->link);
+        wheel->size--;
+    }
+    timer->expires = expires;
+    placeTimer(wheel, timer);
+    wheel->size++;
+    return true;
+}
+
+bool timerWheelCancel(TimerWheel* wheel, TimerWheelTimer* timer) {
+    if (wheel == NULL || timer == NULL) {
+        fprintf(stderr, "Error: TimerWheel or timer is NULL\n");
+        return false;
+    }
+    if (timer->slot == NULL) return false;
+    slotUnlink(timer->slot, &timer->link);
+    timer->slot = NULL;
+    wheel->size--;
+    return true;
+}
+
+size_t timerWheelAdvance(TimerWheel* wheel, uint64_t now) {
+    if (wheel == NULL) {
+        fprintf(stderr, "Error: TimerWheel is NULL\n");
+        return 0;
+    }
+    size_t fired = 0;
+    while (wheel->current <= now) {
+        if (wheel->size == 0) {
+            wheel->current = now + 1;
+            break;
+        }
+        uint64_t tick = wheel->current;
+        for (uint32_t level = 1; level < TIMERWHEEL_LEVELS; level++) {
+            if (((tick >> (TIMERWHEEL_SLOT_BITS * (level - 1))) & SLOT_MASK) != 0) break;
+            cascade(wheel, level, (size_t)((tick >> (TIMERWHEEL_SLOT_BITS * level)) & SLOT_MASK));
+        }
+
+        // Detach the whole slot first so callbacks may cancel or reschedule freely.
+        DoublyLinkedList batch;
+        slotDetach(&wheel->slots[0][tick & SLOT_MASK], &batch);
+        wheel->current = tick + 1;
+        while (batch.head != NULL) {
+            TimerWheelTimer* timer = (TimerWheelTimer*)batch.head->data;
+            slotUnlink(&batch, &timer->link);
+            timer->slot = NULL;
+            wheel->size--;
+            fired++;
+            if (timer->callback != NULL) timer->callback(timer, timer->arg);
+        }
+    }
+    return fired;
+}
+
+size_t timerWheelSize(TimerWheel* wheel) {
+    if (wheel == NULL) {
+        fprintf(stderr, "Error: TimerWheel is NULL\n");
+        return 0;
+    }
+    return wheel->size;
+}
+
+void clearTimerWheel(TimerWheel* wheel) {
+    if (wheel == NULL) {
+        fprintf(stderr, "Error: TimerWheel is NULL\n");
+        return;
+    }
+    for (uint32_t level = 0; level < TIMERWHEEL_LEVELS; level++) {
+        for (size_t i = 0; i < TIMERWHEEL_SLOTS; i++) {
+            DoublyLinkedList* slot = &wheel->slots[level][i];
+            while (slot->head != NULL) {
+                TimerWheelTimer* timer = (TimerWheelTimer*)slot->head->data;
+                slotUnlink(slot, &timer->link);
+                timer->slot = NULL;
+            }
+        }
+    }
+    wheel->size = 0;
+}
+
+void freeTimerWheel(TimerWheel* wheel) {
+    if (wheel == NULL) return;
+    clearTimerWheel(wheel);
+    delete(wheel);
+}
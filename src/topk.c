@@ -0,0 +1,109 @@
+#include "topk.h"
+#include <stdio.h>
+
+// Admission once full: a single compare against the heap top, then one
+// heapReplaceTop on success. Nothing beyond the K kept slots is allocated.
+static bool admit(TopK* topk, void* item) {
+    Heap* heap = topk->heap;
+    if (heap->size < topk->k) {
+        return heapPush(heap, item);
+    }
+    if (heap->cmp(item, heap->data[0]) <= 0) return false;
+    heapReplaceTop(heap, item);
+    return true;
+}
+
+TopK* createTopK(HeapCompare cmp, size_t k) {
+    if (k == 0) {
+        fprintf(stderr, "Error: TopK capacity must be greater than zero\n");
+        return NULL;
+    }
+    TopK* topk = new(TopK);
+    if (topk == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed for TopK\n");
+        return NULL;
+    }
+    topk->heap = createHeapWithCapacity(cmp, k);
+    if (topk->heap == NULL) {
+        delete(topk);
+        return NULL;
+    }
+    topk->k = k;
+    return topk;
+}
+
+size_t topkSize(TopK* topk) {
+    if (topk == NULL) {
+        fprintf(stderr, "Error: TopK is NULL\n");
+        return 0;
+    }
+    return topk->heap->size;
+}
+
+bool topkIsFull(TopK* topk) {
+    if (topk == NULL) {
+        fprintf(stderr, "Error: TopK is NULL\n");
+        return false;
+    }
+    return topk->heap->size >= topk->k;
+}
+
+void* topkThreshold(TopK* topk) {
+    if (topk == NULL) {
+        fprintf(stderr, "Error: TopK is NULL\n");
+        return NULL;
+    }
+    if (topk->heap->size == 0) return NULL;
+    return topk->heap->data[0];
+}
+
+bool topkOffer(TopK* topk, void* item) {
+    if (topk == NULL) {
+        fprintf(stderr, "Error: TopK is NULL\n");
+        return false;
+    }
+    return admit(topk, item);
+}
+
+size_t topkOfferMany(TopK* topk, void** items, size_t count) {
+    if (topk == NULL || items == NULL) {
+        fprintf(stderr, "Error: TopK or items array is NULL\n");
+        return 0;
+    }
+    size_t admitted = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (admit(topk, items[i])) admitted++;
+    }
+    return admitted;
+}
+
+size_t topkDrainSorted(TopK* topk, void** out, size_t max) {
+    if (topk == NULL || out == NULL) {
+        fprintf(stderr, "Error: TopK or output array is NULL\n");
+        return 0;
+    }
+    Heap* heap = topk->heap;
+    while (heap->size > max) {
+        heapPop(heap);
+    }
+    size_t written = heap->size;
+    // Pops come out smallest first, so fill from the back for largest-first order.
+    for (size_t i = written; i > 0; i--) {
+        out[i - 1] = heapPop(heap);
+    }
+    return written;
+}
+
+void clearTopK(TopK* topk) {
+    if (topk == NULL) {
+        fprintf(stderr, "Error: TopK is NULL\n");
+        return;
+    }
+    clearHeap(topk->heap);
+}
+
+void freeTopK(TopK* topk) {
+    if (topk == NULL) return;
+    freeHeap(topk->heap);
+    delete(topk);
+}
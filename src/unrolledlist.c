@@ -0,0 +1,299 @@
+#include "unrolledlist.h"
+#include <stdio.h>
+#include <string.h>
+
+static ULNode* createULNode(UnrolledList* list) {
+    ULNode* node = (ULNode*)malloc(sizeof(ULNode) + list->nodeCapacity * sizeof(void*));
+    if (node == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed for ULNode\n");
+        return NULL;
+    }
+    node->next = NULL;
+    node->prev = NULL;
+    node->count = 0;
+    return node;
+}
+
+// Link fresh node after `after` (or at the front when after is NULL).
+static void linkAfter(UnrolledList* list, ULNode* after, ULNode* node) {
+    node->prev = after;
+    node->next = (after != NULL) ? after->next : list->head;
+    if (node->next != NULL) node->next->prev = node;
+    else list->tail = node;
+    if (after != NULL) after->next = node;
+    else list->head = node;
+}
+
+static void unlinkNode(UnrolledList* list, ULNode* node) {
+    if (node->prev != NULL) node->prev->next = node->next;
+    else list->head = node->next;
+    if (node->next != NULL) node->next->prev = node->prev;
+    else list->tail = node->prev;
+    free(node);
+}
+
+// Find the node holding pos, walking from the nearer end; *offset gets the
+// slot within it. pos == size maps to one past the last slot of the tail.
+static ULNode* locate(UnrolledList* list, int pos, int* offset) {
+    if (pos <= list->size / 2) {
+        ULNode* node = list->head;
+        while (pos > node->count || (pos == node->count && node->next != NULL)) {
+            pos -= node->count;
+            node = node->next;
+        }
+        *offset = pos;
+        return node;
+    }
+    ULNode* node = list->tail;
+    int remaining = list->size - pos;
+    while (remaining > node->count) {
+        remaining -= node->count;
+        node = node->prev;
+    }
+    *offset = node->count - remaining;
+    return node;
+}
+
+static void insertAt(UnrolledList* list, ULNode* node, int offset, void* data) {
+    if (node->count == list->nodeCapacity) {
+        ULNode* fresh = createULNode(list);
+        if (fresh == NULL) return;
+        if (offset == node->count) {
+            // Appending past a full node: start a new one instead of splitting.
+            linkAfter(list, node, fresh);
+            node = fresh;
+            offset = 0;
+        }
+        else if (offset == 0 && node->prev == NULL) {
+            linkAfter(list, NULL, fresh);
+            node = fresh;
+        }
+        else {
+            int half = node->count / 2;
+            memcpy(fresh->items, node->items + half, (node->count - half) * sizeof(void*));
+            fresh->count = node->count - half;
+            node->count = half;
+            linkAfter(list, node, fresh);
+            if (offset > half) {
+                node = fresh;
+                offset -= half;
+            }
+        }
+    }
+    memmove(node->items + offset + 1, node->items + offset, (node->count - offset) * sizeof(void*));
+    node->items[offset] = data;
+    node->count++;
+    list->size++;
+}
+
+static void* removeAt(UnrolledList* list, ULNode* node, int offset) {
+    void* data = node->items[offset];
+    memmove(node->items + offset, node->items + offset + 1, (node->count - offset - 1) * sizeof(void*));
+    node->count--;
+    list->size--;
+    if (node->count == 0) {
+        unlinkNode(list, node);
+        return data;
+    }
+    // Fold an underfull node into a neighbour when the two fit in one node.
+    if (node->count < list->nodeCapacity / 2) {
+        ULNode* left = node;
+        ULNode* right = node->next;
+        if (right == NULL || left->count + right->count > list->nodeCapacity) {
+            right = node;
+            left = node->prev;
+        }
+        if (left != NULL && left->count + right->count <= list->nodeCapacity) {
+            memcpy(left->items + left->count, right->items, right->count * sizeof(void*));
+            left->count += right->count;
+            unlinkNode(list, right);
+        }
+    }
+    return data;
+}
+
+/*      CONSTRUCTOR
+ * ==================== */
+UnrolledList* createUnrolledListWithNodeCapacity(int nodeCapacity) {
+    UnrolledList* list = new(UnrolledList);
+    if (list == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed for UnrolledList\n");
+        return NULL;
+    }
+    if (nodeCapacity < UL_MIN_NODE_CAPACITY) nodeCapacity = UL_MIN_NODE_CAPACITY;
+    if (nodeCapacity > UL_MAX_NODE_CAPACITY) nodeCapacity = UL_MAX_NODE_CAPACITY;
+    list->head = NULL;
+    list->tail = NULL;
+    list->size = 0;
+    list->nodeCapacity = nodeCapacity;
+    return list;
+}
+
+UnrolledList* createUnrolledList(void) {
+    return createUnrolledListWithNodeCapacity(UL_DEFAULT_NODE_CAPACITY);
+}
+
+/*     INSERT NODE
+ * ==================== */
+void UL_insertFront(UnrolledList* list, void* data) {
+    UL_insertNode(list, data, 0);
+}
+
+void UL_insertBack(UnrolledList* list, void* data) {
+    if (list == NULL) {
+        fprintf(stderr, "Error: List is NULL\n");
+        return;
+    }
+    if (list->tail == NULL) {
+        ULNode* node = createULNode(list);
+        if (node == NULL) return;
+        linkAfter(list, NULL, node);
+    }
+    insertAt(list, list->tail, list->tail->count, data);
+}
+
+void UL_insertNode(UnrolledList* list, void* data, int pos) {
+    if (list == NULL) {
+        fprintf(stderr, "Error: List is NULL\n");
+        return;
+    }
+    if (pos < 0 || pos > list->size) {
+        fprintf(stderr, "Error: Invalid position for insertion\n");
+        return;
+    }
+    if (list->head == NULL) {
+        UL_insertBack(list, data);
+        return;
+    }
+    int offset;
+    ULNode* node = locate(list, pos, &offset);
+    insertAt(list, node, offset, data);
+}
+
+/*     REMOVE NODE
+ * ==================== */
+void* UL_removeFront(UnrolledList* list) {
+    if (list == NULL || list->head == NULL) {
+        fprintf(stderr, "Error: List is NULL or empty\n");
+        return NULL;
+    }
+    return removeAt(list, list->head, 0);
+}
+
+void* UL_removeBack(UnrolledList* list) {
+    if (list == NULL || list->tail == NULL) {
+        fprintf(stderr, "Error: List is NULL or empty\n");
+        return NULL;
+    }
+    return removeAt(list, list->tail, list->tail->count - 1);
+}
+
+void* UL_removeNode(UnrolledList* list, int pos) {
+    if (list == NULL) {
+        fprintf(stderr, "Error: List is NULL\n");
+        return NULL;
+    }
+    if (pos < 0 || pos >= list->size) {
+        fprintf(stderr, "Error: Invalid position for removal\n");
+        return NULL;
+    }
+    int offset;
+    ULNode* node = locate(list, pos, &offset);
+    return removeAt(list, node, offset);
+}
+
+/*       GET NODE
+ * ==================== */
+void* UL_getFront(UnrolledList* list) {
+    if (list == NULL || list->head == NULL) {
+        fprintf(stderr, "Error: List is NULL or empty\n");
+        return NULL;
+    }
+    return list->head->items[0];
+}
+
+void* UL_getBack(UnrolledList* list) {
+    if (list == NULL || list->tail == NULL) {
+        fprintf(stderr, "Error: List is NULL or empty\n");
+        return NULL;
+    }
+    return list->tail->items[list->tail->count - 1];
+}
+
+void* UL_getNode(UnrolledList* list, int pos) {
+    if (list == NULL) {
+        fprintf(stderr, "Error: List is NULL\n");
+        return NULL;
+    }
+    if (pos < 0 || pos >= list->size) {
+        fprintf(stderr, "Error: Invalid position for retrieval\n");
+        return NULL;
+    }
+    int offset;
+    ULNode* node = locate(list, pos, &offset);
+    return node->items[offset];
+}
+
+/*       ITERATION
+ * ==================== */
+ULIterator UL_iterBegin(UnrolledList* list) {
+    ULIterator it;
+    it.node = (list != NULL) ? list->head : NULL;
+    it.index = 0;
+    return it;
+}
+
+bool UL_iterNext(ULIterator* it, void** out) {
+    if (it == NULL || out == NULL) {
+        fprintf(stderr, "Error: Iterator or output is NULL\n");
+        return false;
+    }
+    while (it->node != NULL && it->index >= it->node->count) {
+        it->node = it->node->next;
+        it->index = 0;
+    }
+    if (it->node == NULL) return false;
+    *out = it->node->items[it->index++];
+    return true;
+}
+
+/*  DEALOC AND DESTRUCT
+ * ==================== */
+void UL_clearList(UnrolledList* list) {
+    if (list == NULL) {
+        fprintf(stderr, "Error: List is NULL\n");
+        return;
+    }
+    ULNode* current = list->head;
+    while (current != NULL) {
+        ULNode* next = current->next;
+        free(current);
+        current = next;
+    }
+    list->head = NULL;
+    list->tail = NULL;
+    list->size = 0;
+}
+
+void UL_freeList(UnrolledList* list) {
+    if (list == NULL) {
+        fprintf(stderr, "Error: List is NULL\n");
+        return;
+    }
+    UL_clearList(list);
+    delete(list);
+}
+
+/*      PRINT LIST
+ * ==================== */
+void UL_printList(UnrolledList* list, void (*printFunc)(void*)) {
+    if (list == NULL) {
+        fprintf(stderr, "Error: List is NULL\n");
+        return;
+    }
+    for (ULNode* node = list->head; node != NULL; node = node->next) {
+        for (int i = 0; i < node->count; i++) {
+            printFunc(node->items[i]);
+        }
+    }
+}
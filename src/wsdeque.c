@@ -0,0 +1,134 @@
+#include "wsdeque.h"
+#include <stdio.h>
+
+// Memory orders follow Le, Pop, Cohen and Zappa Nardelli, "Correct and
+// Efficient Work-Stealing for Weak Memory Models" (PPoPP 2013).
+
+static WSDequeArray* createArray(size_t size) {
+    WSDequeArray* array = (WSDequeArray*)malloc(sizeof(WSDequeArray) + size * sizeof(_Atomic(void*)));
+    if (array == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed for WSDeque storage\n");
+        return NULL;
+    }
+    array->mask = size - 1;
+    array->retired = NULL;
+    return array;
+}
+
+// Thieves may still be reading the old array, so it is retired rather than
+// freed; growth is geometric, so retired arrays total less than the live one.
+static WSDequeArray* growArray(WSDeque* deque, WSDequeArray* old, int64_t top, int64_t bottom) {
+    WSDequeArray* array = createArray((old->mask + 1) * 2);
+    if (array == NULL) return NULL;
+    for (int64_t i = top; i < bottom; i++) {
+        void* item = atomic_load_explicit(&old->slots[(size_t)i & old->mask], memory_order_relaxed);
+        atomic_store_explicit(&array->slots[(size_t)i & array->mask], item, memory_order_relaxed);
+    }
+    array->retired = old;
+    atomic_store_explicit(&deque->array, array, memory_order_release);
+    return array;
+}
+
+WSDeque* createWSDeque(size_t capacity) {
+    size_t rounded = 2;
+    while (rounded < capacity) rounded <<= 1;
+    WSDeque* deque = new(WSDeque);
+    if (deque == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed for WSDeque\n");
+        return NULL;
+    }
+    WSDequeArray* array = createArray(rounded);
+    if (array == NULL) {
+        delete(deque);
+        return NULL;
+    }
+    atomic_init(&deque->top, 0);
+    atomic_init(&deque->bottom, 0);
+    atomic_init(&deque->array, array);
+    return deque;
+}
+
+size_t wsdequeSize(WSDeque* deque) {
+    if (deque == NULL) {
+        fprintf(stderr, "Error: WSDeque is NULL\n");
+        return 0;
+    }
+    int64_t bottom = atomic_load_explicit(&deque->bottom, memory_order_relaxed);
+    int64_t top = atomic_load_explicit(&deque->top, memory_order_relaxed);
+    return bottom > top ? (size_t)(bottom - top) : 0;
+}
+
+bool wsdequePush(WSDeque* deque, void* item) {
+    if (deque == NULL) {
+        fprintf(stderr, "Error: WSDeque is NULL\n");
+        return false;
+    }
+    int64_t bottom = atomic_load_explicit(&deque->bottom, memory_order_relaxed);
+    int64_t top = atomic_load_explicit(&deque->top, memory_order_acquire);
+    WSDequeArray* array = atomic_load_explicit(&deque->array, memory_order_relaxed);
+    if (bottom - top > (int64_t)array->mask) {
+        array = growArray(deque, array, top, bottom);
+        if (array == NULL) return false;
+    }
+    atomic_store_explicit(&array->slots[(size_t)bottom & array->mask], item, memory_order_relaxed);
+    atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_release);
+    return true;
+}
+
+void* wsdequePop(WSDeque* deque) {
+    if (deque == NULL) {
+        fprintf(stderr, "Error: WSDeque is NULL\n");
+        return NULL;
+    }
+    int64_t bottom = atomic_load_explicit(&deque->bottom, memory_order_relaxed) - 1;
+    WSDequeArray* array = atomic_load_explicit(&deque->array, memory_order_relaxed);
+    atomic_store_explicit(&deque->bottom, bottom, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    int64_t top = atomic_load_explicit(&deque->top, memory_order_relaxed);
+
+    if (top > bottom) {
+        atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+        return NULL;
+    }
+    void* item = atomic_load_explicit(&array->slots[(size_t)bottom & array->mask], memory_order_relaxed);
+    if (top == bottom) {
+        // Last element: race thieves for it through top.
+        if (!atomic_compare_exchange_strong_explicit(&deque->top, &top, top + 1,
+                                                     memory_order_seq_cst, memory_order_relaxed)) {
+            item = NULL;
+        }
+        atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+    }
+    return item;
+}
+
+WSStealResult wsdequeSteal(WSDeque* deque, void** out) {
+    if (deque == NULL || out == NULL) {
+        fprintf(stderr, "Error: WSDeque or output is NULL\n");
+        return WS_STEAL_EMPTY;
+    }
+    int64_t top = atomic_load_explicit(&deque->top, memory_order_acquire);
+    atomic_thread_fence(memory_order_seq_cst);
+    int64_t bottom = atomic_load_explicit(&deque->bottom, memory_order_acquire);
+    if (top >= bottom) return WS_STEAL_EMPTY;
+
+    WSDequeArray* array = atomic_load_explicit(&deque->array, memory_order_acquire);
+    void* item = atomic_load_explicit(&array->slots[(size_t)top & array->mask], memory_order_relaxed);
+    if (!atomic_compare_exchange_strong_explicit(&deque->top, &top, top + 1,
+                                                 memory_order_seq_cst, memory_order_relaxed)) {
+        return WS_STEAL_ABORT;
+    }
+    *out = item;
+    return WS_STEAL_OK;
+}
+
+void freeWSDeque(WSDeque* deque) {
+    if (deque == NULL) return;
+    WSDequeArray* array = atomic_load_explicit(&deque->array, memory_order_relaxed);
+    while (array != NULL) {
+        WSDequeArray* retired = array->retired;
+        free(array);
+        array = retired;
+    }
+    delete(deque);
+}
@@ -2,6 +2,9 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
 
 static int tests_run = 0;
 static int tests_failed = 0;
@@ -50,6 +53,354 @@ static void test_linked_list(void) {
     CHECK(SLL_getBack(list) == &a, "SLL back after removal");
 
     SLL_freeList(list);
+
+    // Duplicates inserted in address order, so stability shows as ascending
+    // addresses among equal keys.
+    int keys[13] = {5, 3, 9, 3, 1, 5, 7, 0, 3, 9, 2, 5, 1};
+    SingleLinkedList* sorted = createSingleLinkedList();
+    for (int i = 0; i < 13; i++) SLL_insertBack(sorted, &keys[i]);
+    SLL_sort(sorted, intCompare);
+    bool ordered = true;
+    for (SLLNode* n = sorted->head; n->next != NULL; n = n->next) {
+        int cmp = intCompare(n->data, n->next->data);
+        if (cmp > 0 || (cmp == 0 && (int*)n->data > (int*)n->next->data)) ordered = false;
+    }
+    CHECK(ordered && sorted->size == 13, "SLL sort is ordered and stable");
+    CHECK(*(int*)SLL_getFront(sorted) == 0 && SLL_getBack(sorted) == &keys[9], "SLL sort fixes head and tail");
+
+    int more[4] = {1, 4, 6, 10};
+    SingleLinkedList* other = createSingleLinkedList();
+    for (int i = 0; i < 4; i++) SLL_insertBack(other, &more[i]);
+    SLL_mergeSorted(sorted, other, intCompare);
+    ordered = true;
+    for (SLLNode* n = sorted->head; n->next != NULL; n = n->next) {
+        if (intCompare(n->data, n->next->data) > 0) ordered = false;
+    }
+    CHECK(ordered && sorted->size == 17 && other->size == 0, "SLL mergeSorted relinks both lists");
+    CHECK(SLL_getBack(sorted) == &more[3], "SLL mergeSorted tail");
+    SLL_freeList(other);
+    SLL_freeList(sorted);
+
+    DoublyLinkedList* dll = createDoublyLinkedList();
+    for (int i = 0; i < 13; i++) {
+        int* value = malloc(sizeof(int));
+        *value = keys[i];
+        DLL_insertBack(dll, value);
+    }
+    DLL_sort(dll, intCompare);
+    ordered = dll->head->prev == NULL;
+    for (DLLNode* n = dll->head; n->next != NULL; n = n->next) {
+        if (intCompare(n->data, n->next->data) > 0 || n->next->prev != n) ordered = false;
+    }
+    CHECK(ordered && *(int*)DLL_getBack(dll) == 9 && dll->tail->next == NULL, "DLL sort relinks prev and tail");
+
+    // dll: 0 1 1 2 3 3 3 5 5 5 7 9 9; move "3 3 3" to the front of a fresh list.
+    DoublyLinkedList* moved = createDoublyLinkedList();
+    DLLNode* first = dll->head->next->next->next->next;
+    CHECK(DLL_splice(moved, NULL, dll, first, first->next->next, 0), "DLL splice counts run");
+    CHECK(moved->size == 3 && dll->size == 10, "DLL splice moves run sizes");
+    DLLNode* gap = dll->head->next->next->next->next;
+    CHECK(*(int*)gap->data == 5 && gap->prev->next == gap && *(int*)gap->prev->data == 2,
+          "DLL splice closes gap in source");
+    CHECK(DLL_splice(moved, moved->head->next, dll, dll->tail, dll->tail, 1), "DLL splice with known count");
+    CHECK(*(int*)DLL_getNode(moved, 1) == 9 && moved->size == 4 && moved->tail->prev->prev->prev == moved->head,
+          "DLL splice inserts mid-list");
+    DoublyLinkedList* foreign = createDoublyLinkedList();
+    CHECK(!DLL_splice(dll, NULL, foreign, moved->head, moved->head, 1) && moved->size == 4,
+          "DLL splice rejects run from another list");
+    DLL_freeList(foreign);
+    CHECK(!DLL_splice(dll, NULL, moved, moved->tail, moved->head, 0) && moved->size == 4,
+          "DLL splice rejects reversed run");
+    DLL_concat(dll, moved);
+    CHECK(dll->size == 13 && moved->size == 0 && *(int*)DLL_getBack(dll) == 3, "DLL concat");
+    DLL_freeList(moved);
+    DLL_freeList(dll);
+
+    SingleLinkedList* left = createSingleLinkedList();
+    SingleLinkedList* right = createSingleLinkedList();
+    for (int i = 0; i < 5; i++) SLL_insertBack(left, &keys[i]);
+    for (int i = 5; i < 8; i++) SLL_insertBack(right, &keys[i]);
+    SLL_concat(left, right);
+    CHECK(left->size == 8 && right->size == 0 && SLL_getBack(left) == &keys[7], "SLL concat");
+    SingleLinkedList* tailPart = SLL_splitAt(left, left->head->next);
+    CHECK(left->size == 2 && left->tail->next == NULL && SLL_getBack(left) == &keys[1], "SLL splitAt keeps prefix");
+    CHECK(tailPart->size == 6 && SLL_getFront(tailPart) == &keys[2] && SLL_getBack(tailPart) == &keys[7],
+          "SLL splitAt returns remainder");
+    SLL_freeList(tailPart);
+    SLL_freeList(right);
+    SLL_freeList(left);
+
+    // Positional access through the cursor cache, checked against an array
+    // model while inserts and removals shift indices around the cursor.
+    int pool[64];
+    int* model[64];
+    int count = 0;
+    SingleLinkedList* seq = createSingleLinkedList();
+    DoublyLinkedList* dseq = createDoublyLinkedList();
+    for (int i = 0; i < 64; i++) pool[i] = i;
+    bool consistent = true;
+    unsigned state = 7;
+    for (int step = 0; step < 400; step++) {
+        state = state * 1103515245u + 12345u;
+        int pos = count > 0 ? (int)((state >> 8) % (unsigned)count) : 0;
+        int op = (int)((state >> 4) % 4);
+        if (count < 40 && (op < 2 || count == 0)) {
+            int* value = &pool[step % 64];
+            int at = (op == 0) ? pos : count;
+            for (int k = count; k > at; k--) model[k] = model[k - 1];
+            model[at] = value;
+            count++;
+            SLL_insertNode(seq, value, at);
+            int* copy = malloc(sizeof(int));
+            *copy = *value;
+            DLL_insertNode(dseq, copy, at);
+        }
+        else if (op == 2) {
+            SLLNode* node = seq->head;
+            DLLNode* dnode = dseq->head;
+            for (int k = 0; k < pos; k++) {
+                node = node->next;
+                dnode = dnode->next;
+            }
+            SLL_removeNode(seq, node, pos);
+            DLL_removeNode(dseq, dnode, pos);
+            for (int k = pos; k < count - 1; k++) model[k] = model[k + 1];
+            count--;
+        }
+        for (int k = pos; k < count; k++) {
+            if (SLL_getNode(seq, k) != model[k] || *(int*)DLL_getNode(dseq, k) != *model[k]) consistent = false;
+        }
+        for (int k = count - 1; k >= 0 && k >= pos - 3; k--) {
+            if (*(int*)DLL_getNode(dseq, k) != *model[k]) consistent = false;
+        }
+    }
+    CHECK(consistent && seq->size == count && dseq->size == count, "list cursor cache matches model");
+    SLL_freeList(seq);
+    DLL_freeList(dseq);
+}
+
+static void test_unrolled_list(void) {
+    UnrolledList* list = createUnrolledListWithNodeCapacity(16);
+    static int vals[500];
+    int* model[500];
+    int count = 0;
+    for (int i = 0; i < 500; i++) vals[i] = i;
+    for (int i = 0; i < 100; i++) {
+        UL_insertBack(list, &vals[i]);
+        model[count++] = &vals[i];
+    }
+    CHECK(list->size == 100 && UL_getFront(list) == &vals[0] && UL_getBack(list) == &vals[99],
+          "unrolled list append");
+
+    // Mixed positional edits against an array model.
+    bool consistent = true;
+    unsigned state = 11;
+    for (int step = 0; step < 2000; step++) {
+        state = state * 1103515245u + 12345u;
+        int pos = (int)((state >> 8) % (unsigned)(count + 1));
+        if ((state >> 4) % 2 == 0 && count < 500) {
+            UL_insertNode(list, &vals[step % 500], pos);
+            for (int k = count; k > pos; k--) model[k] = model[k - 1];
+            model[pos] = &vals[step % 500];
+            count++;
+        }
+        else if (count > 0) {
+            if (pos == count) pos--;
+            if (UL_removeNode(list, pos) != model[pos]) consistent = false;
+            for (int k = pos; k < count - 1; k++) model[k] = model[k + 1];
+            count--;
+        }
+    }
+    ULIterator it = UL_iterBegin(list);
+    void* item;
+    int seen = 0;
+    while (UL_iterNext(&it, &item)) {
+        if (seen >= count || item != model[seen]) consistent = false;
+        seen++;
+    }
+    int nodes = 0;
+    for (ULNode* node = list->head; node != NULL; node = node->next) nodes++;
+    CHECK(consistent && seen == count && list->size == count, "unrolled list edits match model");
+    CHECK(count == 0 || UL_getNode(list, count / 2) == model[count / 2], "unrolled list get by position");
+    CHECK(nodes * 4 <= count + 64, "unrolled list nodes stay densely packed");
+
+    while (list->size > 0) UL_removeFront(list);
+    CHECK(list->head == NULL && list->tail == NULL, "unrolled list empty after removals");
+    UL_freeList(list);
+}
+
+typedef struct TestTask {
+    int id;
+    ListLink link;
+} TestTask;
+
+static void test_intrusive_list(void) {
+    IntrusiveList* list = createIntrusiveList();
+    TestTask tasks[4];
+    for (int i = 0; i < 4; i++) {
+        tasks[i].id = i;
+        IL_initLink(&tasks[i].link);
+    }
+    CHECK(!IL_isLinked(&tasks[0].link), "intrusive link starts unlinked");
+    IL_insertBack(list, &tasks[1].link);
+    IL_insertFront(list, &tasks[0].link);
+    IL_insertBack(list, &tasks[3].link);
+    IL_insertAfter(list, &tasks[1].link, &tasks[2].link);
+    bool ordered = list->size == 4;
+    int expected = 0;
+    for (ListLink* link = list->head; link != NULL; link = link->next) {
+        if (LIST_CONTAINER_OF(link, TestTask, link)->id != expected++) ordered = false;
+    }
+    CHECK(ordered && list->tail == &tasks[3].link, "intrusive list order via container_of");
+
+    IL_removeNode(list, &tasks[2].link);
+    CHECK(!IL_isLinked(&tasks[2].link) && list->size == 3 && tasks[1].link.next == &tasks[3].link,
+          "intrusive list remove middle");
+    CHECK(LIST_CONTAINER_OF(IL_popFront(list), TestTask, link) == &tasks[0], "intrusive list pop front");
+    CHECK(LIST_CONTAINER_OF(IL_popBack(list), TestTask, link) == &tasks[3], "intrusive list pop back");
+    IL_freeList(list);
+    CHECK(!IL_isLinked(&tasks[1].link), "intrusive list free unlinks elements");
+}
+
+static void test_skip_list(void) {
+    IndexedSkipList* list = createIndexedSkipList();
+    static int vals[3000];
+    static int* model[3000];
+    int count = 0;
+    for (int i = 0; i < 3000; i++) vals[i] = i;
+    ISL_insertBack(list, &vals[1]);
+    ISL_insertFront(list, &vals[0]);
+    CHECK(ISL_getFront(list) == &vals[0] && ISL_getBack(list) == &vals[1], "skip list front/back");
+    ISL_removeFront(list);
+    ISL_removeBack(list);
+    CHECK(list->size == 0 && list->tail == NULL, "skip list empty after removals");
+
+    bool consistent = true;
+    unsigned state = 3;
+    for (int step = 0; step < 6000; step++) {
+        state = state * 1103515245u + 12345u;
+        int pos = (int)((state >> 8) % (unsigned)(count + 1));
+        if ((state >> 4) % 3 != 0 && count < 3000) {
+            ISL_insertNode(list, &vals[step % 3000], pos);
+            for (int k = count; k > pos; k--) model[k] = model[k - 1];
+            model[pos] = &vals[step % 3000];
+            count++;
+        }
+        else if (count > 0) {
+            if (pos == count) pos--;
+            if (ISL_removeNode(list, pos) != model[pos]) consistent = false;
+            for (int k = pos; k < count - 1; k++) model[k] = model[k + 1];
+            count--;
+        }
+        if (count > 0) {
+            int probe = (int)((state >> 12) % (unsigned)count);
+            if (ISL_getNode(list, probe) != model[probe]) consistent = false;
+        }
+    }
+    CHECK(consistent && list->size == count, "skip list positional edits match model");
+
+    int seen = 0;
+    for (SkipListNode* node = ISL_firstNode(list); node != NULL; node = ISL_nextNode(node)) {
+        if (seen >= count || node->data != model[seen]) consistent = false;
+        seen++;
+    }
+    for (SkipListNode* node = list->tail; node != NULL; node = node->prev) {
+        if (node->data != model[--seen]) consistent = false;
+    }
+    CHECK(consistent && seen == 0, "skip list forward and backward iteration");
+    ISL_freeList(list);
+}
+
+static void test_arena_list(void) {
+    ArenaList* list = createArenaList(0);
+    int vals[10];
+    ArenaIndex handles[10];
+    for (int i = 0; i < 10; i++) {
+        vals[i] = i;
+        handles[i] = AL_insertBack(list, &vals[i]);
+    }
+    CHECK(list->size == 10 && AL_getFront(list) == &vals[0] && AL_getBack(list) == &vals[9], "arena list append");
+    AL_removeNode(list, handles[3]);
+    AL_removeNode(list, handles[0]);
+    CHECK(AL_getData(list, handles[3]) == NULL && list->size == 8, "arena list rejects removed handle");
+    ArenaIndex reused = AL_insertFront(list, &vals[0]);
+    CHECK(reused == handles[0] && list->used == 10, "arena list recycles freed slots");
+    AL_insertAfter(list, handles[2], &vals[3]);
+
+    ArenaList* copy = AL_clone(list);
+    AL_removeNode(list, handles[9]);
+    bool ordered = copy->size == 10;
+    int expected = 0;
+    for (ArenaIndex node = copy->head; node != ARENA_NIL; node = AL_next(copy, node)) {
+        if (AL_getData(copy, node) != &vals[expected++]) ordered = false;
+    }
+    CHECK(ordered && AL_getBack(copy) == &vals[9], "arena list clone is independent");
+
+    CHECK(AL_compact(copy) && copy->head == 0 && copy->tail == 9 && copy->freeHead == ARENA_NIL,
+          "arena list compact renumbers in order");
+    ordered = true;
+    for (ArenaIndex i = 0; i < 10; i++) {
+        if (copy->data[i] != &vals[i] || (i > 0 && AL_prev(copy, i) != i - 1)) ordered = false;
+    }
+    CHECK(ordered, "arena list compact keeps order");
+    AL_freeList(copy);
+    AL_freeList(list);
+}
+
+#define LFSL_TEST_THREADS 4
+#define LFSL_TEST_KEYS 512
+static int lfsl_keys[LFSL_TEST_KEYS];
+static _Atomic int lfsl_inserted;
+static _Atomic int lfsl_reclaimed;
+
+static void lfsl_count_free(void* key) {
+    (void)key;
+    atomic_fetch_add(&lfsl_reclaimed, 1);
+}
+
+static void* lfsl_test_worker(void* arg) {
+    LockFreeSortedList* list = arg;
+    // Every thread races on the same keys: insert all, then remove evens.
+    for (int i = 0; i < LFSL_TEST_KEYS; i++) {
+        if (lfslInsert(list, &lfsl_keys[i])) atomic_fetch_add(&lfsl_inserted, 1);
+        if (i % 64 == 0) sched_yield();
+    }
+    for (int i = 0; i < LFSL_TEST_KEYS; i += 2) {
+        lfslRemove(list, &lfsl_keys[i]);
+        if (i % 64 == 0) sched_yield();
+    }
+    lfslThreadExit(list);
+    return NULL;
+}
+
+static void test_lf_sorted_list(void) {
+    for (int i = 0; i < LFSL_TEST_KEYS; i++) lfsl_keys[i] = i;
+    atomic_store(&lfsl_inserted, 0);
+    atomic_store(&lfsl_reclaimed, 0);
+    LockFreeSortedList* list = createLockFreeSortedList(intCompare, lfsl_count_free);
+    CHECK(lfslInsert(list, &lfsl_keys[5]) && lfslInsert(list, &lfsl_keys[1]) && lfslInsert(list, &lfsl_keys[3]),
+          "lf sorted list inserts");
+    CHECK(!lfslInsert(list, &lfsl_keys[3]) && lfslSize(list) == 3, "lf sorted list rejects duplicates");
+    LFSLNode* first = (LFSLNode*)atomic_load(&list->head.next);
+    CHECK(first->key == &lfsl_keys[1], "lf sorted list keeps order");
+    CHECK(lfslContains(list, &lfsl_keys[5]) && !lfslContains(list, &lfsl_keys[4]), "lf sorted list contains");
+    CHECK(lfslRemove(list, &lfsl_keys[1]) && !lfslRemove(list, &lfsl_keys[1]), "lf sorted list remove once");
+    CHECK(lfslSize(list) == 2 && !lfslContains(list, &lfsl_keys[1]), "lf sorted list size after remove");
+    lfslRemove(list, &lfsl_keys[3]);
+    lfslRemove(list, &lfsl_keys[5]);
+    lfslThreadExit(list);
+
+    pthread_t threads[LFSL_TEST_THREADS];
+    for (int t = 0; t < LFSL_TEST_THREADS; t++) pthread_create(&threads[t], NULL, lfsl_test_worker, list);
+    for (int t = 0; t < LFSL_TEST_THREADS; t++) pthread_join(threads[t], NULL);
+    CHECK(atomic_load(&lfsl_inserted) >= LFSL_TEST_KEYS, "lf sorted list concurrent inserts");
+    bool odds = true;
+    for (int i = 0; i < LFSL_TEST_KEYS; i++) {
+        if (lfslContains(list, &lfsl_keys[i]) != (i % 2 == 1)) odds = false;
+    }
+    CHECK(odds && lfslSize(list) == LFSL_TEST_KEYS / 2, "lf sorted list concurrent removes leave odd keys");
+    freeLockFreeSortedList(list);
+    CHECK(atomic_load(&lfsl_reclaimed) == atomic_load(&lfsl_inserted) + 3, "lf sorted list reclaims every node once");
 }
 
 static void test_stack(void) {
@@ -62,7 +413,75 @@ static void test_stack(void) {
     CHECK(pop(stack) == &b, "stack pop order");
     CHECK(pop(stack) == &a, "stack pop second");
     CHECK(isStackEmpty(stack), "stack empty after pops");
+    CHECK(!isStackFull(stack), "unbounded stack never full");
     freeStack(stack);
+
+    Stack* bounded = createStackWithCapacity(3);
+    int vals[] = {1, 2, 3, 4};
+    void* items[] = {&vals[0], &vals[1], &vals[2], &vals[3]};
+    CHECK(pushMany(bounded, items, 4) == 3, "bounded stack pushMany stops at cap");
+    CHECK(isStackFull(bounded), "bounded stack full");
+    push(bounded, &vals[3]);
+    CHECK(getStackSize(bounded) == 3, "bounded stack rejects push when full");
+    void* out[4];
+    CHECK(popMany(bounded, out, 4) == 3, "stack popMany count");
+    CHECK(out[0] == &vals[2] && out[2] == &vals[0], "stack popMany order");
+    freeStack(bounded);
+}
+
+#define LFS_TEST_THREADS 4
+#define LFS_TEST_ITEMS 2000
+static _Atomic int lfs_taken[LFS_TEST_THREADS * LFS_TEST_ITEMS];
+static int lfs_vals[LFS_TEST_THREADS * LFS_TEST_ITEMS];
+
+static void* lfs_test_worker(void* arg) {
+    LockFreeStack* stack = ((void**)arg)[0];
+    int base = *(int*)((void**)arg)[1];
+    for (int i = 0; i < LFS_TEST_ITEMS; i++) {
+        lfstackPush(stack, &lfs_vals[base + i]);
+        if (i % 2 == 1) {
+            for (int j = 0; j < 2; j++) {
+                void* item;
+                while ((item = lfstackPop(stack)) == NULL) sched_yield();
+                atomic_fetch_add(&lfs_taken[*(int*)item], 1);
+            }
+        }
+    }
+    return NULL;
+}
+
+static void test_lf_stack(void) {
+    LockFreeStack* stack = createLockFreeStack();
+    int a = 10, b = 20;
+    lfstackPush(stack, &a);
+    lfstackPush(stack, &b);
+    CHECK(lfstackSize(stack) == 2, "lf stack size after pushes");
+    CHECK(lfstackPeek(stack) == &b, "lf stack peek");
+    CHECK(lfstackPop(stack) == &b, "lf stack pop order");
+    CHECK(lfstackPop(stack) == &a, "lf stack pop second");
+    CHECK(lfstackIsEmpty(stack) && lfstackPop(stack) == NULL, "lf stack empty after pops");
+
+    // Push/pop pairs from several threads; every item popped exactly once.
+    pthread_t threads[LFS_TEST_THREADS];
+    int bases[LFS_TEST_THREADS];
+    void* args[LFS_TEST_THREADS][2];
+    for (int i = 0; i < LFS_TEST_THREADS * LFS_TEST_ITEMS; i++) {
+        lfs_vals[i] = i;
+        atomic_store(&lfs_taken[i], 0);
+    }
+    for (int t = 0; t < LFS_TEST_THREADS; t++) {
+        bases[t] = t * LFS_TEST_ITEMS;
+        args[t][0] = stack;
+        args[t][1] = &bases[t];
+        pthread_create(&threads[t], NULL, lfs_test_worker, args[t]);
+    }
+    for (int t = 0; t < LFS_TEST_THREADS; t++) pthread_join(threads[t], NULL);
+    bool once = true;
+    for (int i = 0; i < LFS_TEST_THREADS * LFS_TEST_ITEMS; i++) {
+        if (atomic_load(&lfs_taken[i]) != 1) once = false;
+    }
+    CHECK(once && lfstackIsEmpty(stack), "lf stack concurrent pops take each item exactly once");
+    freeLockFreeStack(stack);
 }
 
 static void test_queue(void) {
@@ -75,7 +494,148 @@ static void test_queue(void) {
     CHECK(Dequeue(q) == &a, "queue dequeue order");
     CHECK(Dequeue(q) == &b, "queue dequeue second");
     CHECK(isQueueEmpty(q), "queue empty after dequeues");
+    CHECK(q->pool.totalCount == QUEUE_NODE_SLAB && q->pool.freeCount == QUEUE_NODE_SLAB,
+          "queue nodes recycled into pool");
+    Queue* pooled = createQueue();
+    setQueueNodeCache(pooled, 4, 8);
+    int vals[100];
+    for (int i = 0; i < 100; i++) Enqueue(pooled, &vals[i]);
+    bool fifo = true;
+    for (int i = 0; i < 90; i++) {
+        if (Dequeue(pooled) != &vals[i]) fifo = false;
+    }
+    CHECK(pooled->pool.totalCount - pooled->pool.freeCount == 10 && pooled->pool.freeCount < 8 + 4,
+          "queue pool releases slabs without a full drain");
+    for (int i = 90; i < 100; i++) {
+        if (Dequeue(pooled) != &vals[i]) fifo = false;
+    }
+    CHECK(fifo, "queue order with pooled nodes");
+    CHECK(pooled->pool.totalCount < 8 + 4, "queue pool trimmed to high-water after drain");
+    freeQueue(pooled);
+
+    // Draining a large queue must stay linear: slabs are released in O(1).
+    Queue* large = createQueue();
+    clock_t started = clock();
+    for (int i = 0; i < 1000000; i++) Enqueue(large, &a);
+    while (!isQueueEmpty(large)) Dequeue(large);
+    double seconds = (double)(clock() - started) / CLOCKS_PER_SEC;
+    CHECK(large->pool.totalCount < QUEUE_NODE_HIGH_WATER + QUEUE_NODE_SLAB, "queue large drain returns slabs");
+    CHECK(seconds < 2.0, "queue large fill and drain stays linear");
+    freeQueue(large);
+
+    void* items[256];
+    void* batch[256];
+    for (int i = 0; i < 100; i++) items[i] = &vals[i];
+    Enqueue(q, &a);
+    CHECK(EnqueueMany(q, items, 100) == 100 && getQueueSize(q) == 101, "queue EnqueueMany");
+    CHECK(DequeueMany(q, batch, 256) == 101, "queue DequeueMany count");
+    CHECK(batch[0] == &a && batch[1] == &vals[0] && batch[100] == &vals[99], "queue DequeueMany order");
+    CHECK(isQueueEmpty(q), "queue empty after DequeueMany");
     freeQueue(q);
+
+    Queue* bounded = createQueueWithCapacity(2);
+    int c = 7;
+    void* out = NULL;
+    CHECK(tryEnqueue(bounded, &a) == QUEUE_OK, "bounded queue enqueue");
+    CHECK(tryEnqueue(bounded, &b) == QUEUE_OK, "bounded queue enqueue second");
+    CHECK(isQueueFull(bounded), "bounded queue full");
+    CHECK(tryEnqueue(bounded, &c) == QUEUE_FULL, "bounded queue backpressure");
+    CHECK(tryDequeue(bounded, &out) == QUEUE_OK && out == &a, "bounded queue dequeue order");
+    CHECK(tryEnqueue(bounded, &c) == QUEUE_OK, "bounded queue wraps");
+    CHECK(Dequeue(bounded) == &b && Dequeue(bounded) == &c, "bounded queue order after wrap");
+    CHECK(tryDequeue(bounded, &out) == QUEUE_EMPTY, "bounded queue empty status");
+    Enqueue(bounded, &a);
+    void* pair[] = {&b, &c};
+    CHECK(EnqueueMany(bounded, pair, 2) == 1, "bounded queue EnqueueMany stops at capacity");
+    CHECK(DequeueMany(bounded, batch, 4) == 2 && batch[0] == &a && batch[1] == &b,
+          "bounded queue DequeueMany across wrap");
+    freeQueue(bounded);
+}
+
+static void test_spsc_queue(void) {
+    SPSCQueue* q = createSPSCQueue(3);
+    int vals[] = {1, 2, 3, 4, 5, 6};
+    void* items[] = {&vals[0], &vals[1], &vals[2], &vals[3], &vals[4], &vals[5]};
+    CHECK(spscCapacity(q) == 4, "spsc capacity rounded to power of two");
+    CHECK(spscEnqueue(q, items[0]), "spsc enqueue");
+    CHECK(spscEnqueueMany(q, items + 1, 5) == 3, "spsc enqueueMany stops when full");
+    CHECK(!spscEnqueue(q, items[4]), "spsc enqueue full");
+    void* out[4];
+    CHECK(spscDequeue(q, out) && out[0] == &vals[0], "spsc dequeue order");
+    CHECK(spscEnqueueMany(q, items + 4, 2) == 1, "spsc enqueueMany wraps");
+    CHECK(spscDequeueMany(q, out, 4) == 4, "spsc dequeueMany count");
+    CHECK(out[0] == &vals[1] && out[3] == &vals[4], "spsc dequeueMany order");
+    CHECK(!spscDequeue(q, out) && spscSize(q) == 0, "spsc empty");
+    freeSPSCQueue(q);
+}
+
+#define MPMC_TEST_ITEMS 2000
+
+static void* mpmc_test_producer(void* arg) {
+    static int payload[MPMC_TEST_ITEMS];
+    for (int i = 0; i < MPMC_TEST_ITEMS; i++) {
+        payload[i] = i + 1;
+        mpmcEnqueue((MPMCQueue*)arg, &payload[i]);
+    }
+    return NULL;
+}
+
+static void* mpmc_test_consumer(void* arg) {
+    long sum = 0;
+    for (int i = 0; i < MPMC_TEST_ITEMS / 2; i++) {
+        sum += *(int*)mpmcDequeue((MPMCQueue*)arg);
+    }
+    return (void*)sum;
+}
+
+static void test_mpmc_queue(void) {
+    MPMCQueue* q = createMPMCQueue(2);
+    int a = 1, b = 2;
+    void* out = NULL;
+    CHECK(mpmcTryEnqueue(q, &a) && mpmcTryEnqueue(q, &b), "mpmc enqueue");
+    CHECK(!mpmcTryEnqueue(q, &a), "mpmc full");
+    CHECK(mpmcTryDequeue(q, &out) && out == &a, "mpmc dequeue order");
+    CHECK(mpmcTryDequeue(q, &out) && out == &b, "mpmc dequeue second");
+    CHECK(!mpmcTryDequeue(q, &out), "mpmc empty");
+
+    // One producer, two blocking consumers over a tiny ring.
+    pthread_t producer, consumers[2];
+    pthread_create(&producer, NULL, mpmc_test_producer, q);
+    pthread_create(&consumers[0], NULL, mpmc_test_consumer, q);
+    pthread_create(&consumers[1], NULL, mpmc_test_consumer, q);
+    void* sums[2];
+    pthread_join(producer, NULL);
+    pthread_join(consumers[0], &sums[0]);
+    pthread_join(consumers[1], &sums[1]);
+    long expected = (long)MPMC_TEST_ITEMS * (MPMC_TEST_ITEMS + 1) / 2;
+    CHECK((long)sums[0] + (long)sums[1] == expected, "mpmc blocking handoff delivers every item once");
+    freeMPMCQueue(q);
+}
+
+static void* bq_test_waiter(void* arg) {
+    void* item = NULL;
+    return (void*)(long)bqDequeueWait((BlockingQueue*)arg, &item, -1);
+}
+
+static void test_blocking_queue(void) {
+    BlockingQueue* q = createBlockingQueue();
+    int vals[] = {1, 2, 3};
+    void* items[] = {&vals[0], &vals[1], &vals[2]};
+    void* out[4];
+    CHECK(bqEnqueue(q, items[0]), "blocking queue enqueue");
+    CHECK(bqEnqueueMany(q, items + 1, 2) == 2, "blocking queue enqueueMany");
+    CHECK(bqDequeueWait(q, out, 0) == QUEUE_OK && out[0] == &vals[0], "blocking queue dequeue");
+    CHECK(bqDrainTo(q, out, 4, 0) == 2 && out[1] == &vals[2], "blocking queue drain");
+    CHECK(bqDequeueWait(q, out, 10) == QUEUE_TIMEOUT, "blocking queue timed wait expires");
+
+    pthread_t waiter;
+    pthread_create(&waiter, NULL, bq_test_waiter, q);
+    bqClose(q);
+    void* status;
+    pthread_join(waiter, &status);
+    CHECK((QueueStatus)(long)status == QUEUE_CLOSED, "blocking queue close wakes waiter");
+    CHECK(!bqEnqueue(q, items[0]), "blocking queue rejects after close");
+    freeBlockingQueue(q);
 }
 
 static void test_deque(void) {
@@ -90,9 +650,89 @@ static void test_deque(void) {
     CHECK(popFront(d) == &a, "deque pop front");
     CHECK(popBack(d) == &c, "deque pop back");
     CHECK(getDequeSize(d) == 1, "deque size after pops");
+
+    int vals[40];
+    for (int i = 0; i < 40; i++) {
+        vals[i] = i;
+        if (i % 2 == 0) pushBack(d, &vals[i]);
+        else pushFront(d, &vals[i]);
+    }
+    CHECK(getDequeSize(d) == 41, "deque size after growth");
+    CHECK(Deque_at(d, 0) == &vals[39] && Deque_at(d, 40) == &vals[38], "deque random access ends");
+    CHECK(Deque_at(d, 20) == &b, "deque random access middle");
+    CHECK(popBack(d) == &vals[38], "deque pop back after wrap");
+
+    // Front sits mid-buffer, so both bulk copies wrap around the ring.
+    void* items[300];
+    void* out[300];
+    for (int i = 0; i < 300; i++) items[i] = &vals[i % 40];
+    CHECK(pushBackMany(d, items, 300) == 300 && getDequeSize(d) == 340, "deque pushBackMany");
+    CHECK(Deque_at(d, 40) == items[0] && Deque_peekBack(d) == items[299], "deque pushBackMany order");
+    CHECK(dequeDrainTo(d, out, 40) == 40 && out[0] == &vals[39], "deque drain front first");
+    CHECK(dequeDrainTo(d, out, 300) == 300 && out[299] == items[299], "deque drain remaining");
+    CHECK(isDequeEmpty(d), "deque empty after drain");
     freeDeque(d);
 }
 
+#define WS_TEST_ITEMS 5000
+static _Atomic int ws_taken[WS_TEST_ITEMS];
+
+static void* ws_test_thief(void* arg) {
+    WSDeque* dq = (WSDeque*)arg;
+    int misses = 0;
+    while (misses < 1000) {
+        void* item;
+        WSStealResult result = wsdequeSteal(dq, &item);
+        if (result == WS_STEAL_OK) {
+            atomic_fetch_add(&ws_taken[*(int*)item], 1);
+            misses = 0;
+        } else if (result == WS_STEAL_EMPTY) {
+            misses++;
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+static void test_ws_deque(void) {
+    WSDeque* dq = createWSDeque(2);
+    int a = 1, b = 2, c = 3;
+    wsdequePush(dq, &a);
+    wsdequePush(dq, &b);
+    wsdequePush(dq, &c);
+    CHECK(wsdequeSize(dq) == 3, "ws deque size after growth");
+    void* out = NULL;
+    CHECK(wsdequeSteal(dq, &out) == WS_STEAL_OK && out == &a, "ws deque steal takes oldest");
+    CHECK(wsdequePop(dq) == &c, "ws deque pop takes newest");
+    CHECK(wsdequePop(dq) == &b && wsdequePop(dq) == NULL, "ws deque pop until empty");
+    CHECK(wsdequeSteal(dq, &out) == WS_STEAL_EMPTY, "ws deque steal empty");
+
+    // Owner pushes and pops while two thieves steal; every item taken once.
+    static int vals[WS_TEST_ITEMS];
+    pthread_t thieves[2];
+    for (int i = 0; i < WS_TEST_ITEMS; i++) atomic_store(&ws_taken[i], 0);
+    pthread_create(&thieves[0], NULL, ws_test_thief, dq);
+    pthread_create(&thieves[1], NULL, ws_test_thief, dq);
+    for (int i = 0; i < WS_TEST_ITEMS; i++) {
+        vals[i] = i;
+        wsdequePush(dq, &vals[i]);
+        if (i % 3 == 0) {
+            void* item = wsdequePop(dq);
+            if (item != NULL) atomic_fetch_add(&ws_taken[*(int*)item], 1);
+        }
+    }
+    void* item;
+    while ((item = wsdequePop(dq)) != NULL) atomic_fetch_add(&ws_taken[*(int*)item], 1);
+    pthread_join(thieves[0], NULL);
+    pthread_join(thieves[1], NULL);
+    bool once = true;
+    for (int i = 0; i < WS_TEST_ITEMS; i++) {
+        if (atomic_load(&ws_taken[i]) != 1) once = false;
+    }
+    CHECK(once, "ws deque concurrent steal takes each item exactly once");
+    freeWSDeque(dq);
+}
+
 static int bt_collect[8];
 static size_t bt_idx = 0;
 static void bt_visit(void* data) {
@@ -101,6 +741,27 @@ static void bt_visit(void* data) {
     }
 }
 
+typedef struct BTCollect {
+    int vals[16];
+    int count;
+    int limit;
+} BTCollect;
+
+static bool bt_collect_ctx(void* data, void* context) {
+    BTCollect* out = context;
+    if (out->count < 16) out->vals[out->count] = *(int*)data;
+    out->count++;
+    return out->count < out->limit;
+}
+
+static bool bt_sequence_is(const BTCollect* got, const int* want, int n) {
+    if (got->count != n) return false;
+    for (int i = 0; i < n; i++) {
+        if (got->vals[i] != want[i]) return false;
+    }
+    return true;
+}
+
 static void test_binary_tree(void) {
     int rootVal = 2, leftVal = 1, rightVal = 3;
     BinaryTree* tree = createBinaryTree(&rootVal);
@@ -117,7 +778,61 @@ static void test_binary_tree(void) {
     inorderTraversal(tree, bt_visit);
     CHECK(bt_idx == 2, "binary tree traversal after remove");
     CHECK(bt_collect[0] == 2 && bt_collect[1] == 3, "binary tree inorder after remove");
+    CHECK(getBinaryTreeSize(tree) == 2 && tree->root->height == 2, "binary tree cached size after remove");
+
+    // Degenerate chain: cached size/height stay exact without full recounts.
+    BTNode* tip = tree->root->right;
+    for (int i = 0; i < 10000; i++) {
+        insertLeft(tree, tip, &leftVal);
+        tip = tip->left;
+    }
+    CHECK(getBinaryTreeSize(tree) == 10002 && getBinaryTreeDepth(tree) == 10002, "binary tree chain size/depth");
+    BTCollect chainCount = { {0}, 0, 1 << 30 };
+    CHECK(inorderWalk(tree, bt_collect_ctx, &chainCount) && chainCount.count == 10002, "binary tree deep inorder walk");
+    chainCount.count = 0;
+    CHECK(postorderWalk(tree, bt_collect_ctx, &chainCount) && chainCount.count == 10002, "binary tree deep postorder walk");
+    insertLeft(tree, tree->root->right, &leftVal);
+    CHECK(tree->root->right->size == 10002 && getBinaryTreeDepth(tree) == 10003, "binary tree insert above chain");
+    removeNode(tree, tree->root->right->left);
+    CHECK(getBinaryTreeSize(tree) == 2 && getBinaryTreeDepth(tree) == 2, "binary tree remove chain");
+    BTNode* detached = createBTNode(&leftVal);
+    setBTNodeLeft(detached, createBTNode(&rightVal));
+    setBTNodeLeft(tree->root, detached);
+    CHECK(getBinaryTreeSize(tree) == 4 && getBinaryTreeDepth(tree) == 3, "binary tree setBTNodeLeft refreshes cache");
     destroyBinaryTree(tree);
+
+    // Full tree holding 1..7 in order.
+    int v[8] = {0, 1, 2, 3, 4, 5, 6, 7};
+    BinaryTree* full = createBinaryTree(&v[4]);
+    insertLeft(full, full->root, &v[2]);
+    insertRight(full, full->root, &v[6]);
+    insertLeft(full, full->root->left, &v[1]);
+    insertRight(full, full->root->left, &v[3]);
+    insertLeft(full, full->root->right, &v[5]);
+    insertRight(full, full->root->right, &v[7]);
+    const int pre[] = {4, 2, 1, 3, 6, 5, 7};
+    const int in[] = {1, 2, 3, 4, 5, 6, 7};
+    const int post[] = {1, 3, 2, 5, 7, 6, 4};
+    const int level[] = {4, 2, 6, 1, 3, 5, 7};
+    BTCollect got = { {0}, 0, 100 };
+    CHECK(preorderWalk(full, bt_collect_ctx, &got) && bt_sequence_is(&got, pre, 7), "binary tree preorder walk");
+    got.count = 0;
+    CHECK(inorderWalk(full, bt_collect_ctx, &got) && bt_sequence_is(&got, in, 7), "binary tree inorder walk");
+    got.count = 0;
+    CHECK(postorderWalk(full, bt_collect_ctx, &got) && bt_sequence_is(&got, post, 7), "binary tree postorder walk");
+    BTWorkspace* ws = createBTWorkspace();
+    got.count = 0;
+    CHECK(levelorderWalk(full, ws, bt_collect_ctx, &got) && bt_sequence_is(&got, level, 7), "binary tree levelorder walk");
+    BTNode** buffer = ws->queue;
+    got.count = 0;
+    got.limit = 3;
+    CHECK(!levelorderWalk(full, ws, bt_collect_ctx, &got) && bt_sequence_is(&got, level, 3),
+          "binary tree levelorder early stop");
+    CHECK(ws->queue == buffer && ws->capacity == 7, "binary tree workspace reused without allocation");
+    got.count = 0;
+    CHECK(!inorderWalk(full, bt_collect_ctx, &got) && bt_sequence_is(&got, in, 3), "binary tree inorder early stop");
+    freeBTWorkspace(ws);
+    destroyBinaryTree(full);
 }
 
 static void test_heap(void) {
@@ -138,6 +853,178 @@ static void test_heap(void) {
     freeHeap(heap);
 }
 
+static void test_topk(void) {
+    TopK* topk = createTopK(intCompare, 3);
+    int vals[] = {5, 1, 9, 3, 7, 2, 8};
+    void* items[7];
+    for (size_t i = 0; i < 7; i++) items[i] = &vals[i];
+    topkOffer(topk, items[0]);
+    size_t admitted = topkOfferMany(topk, items + 1, 6);
+    CHECK(topkIsFull(topk), "topk full after offers");
+    CHECK(admitted == 5, "topk admitted count");
+    CHECK(*(int*)topkThreshold(topk) == 7, "topk threshold");
+    CHECK(!topkOffer(topk, &vals[3]), "topk rejects below threshold");
+
+    void* out[3];
+    size_t n = topkDrainSorted(topk, out, 3);
+    CHECK(n == 3, "topk drain count");
+    CHECK(*(int*)out[0] == 9 && *(int*)out[1] == 8 && *(int*)out[2] == 7, "topk drain order");
+    CHECK(topkSize(topk) == 0, "topk empty after drain");
+    freeTopK(topk);
+}
+
+static void test_radix_heap(void) {
+    RadixHeap* heap = createRadixHeap();
+    int vals[] = {40, 7, 1000000, 7, 12};
+    for (size_t i = 0; i < sizeof(vals) / sizeof(vals[0]); i++) {
+        radixHeapPush(heap, (uint64_t)vals[i], &vals[i]);
+    }
+    CHECK(radixHeapSize(heap) == 5, "radix heap size after pushes");
+    uint64_t key = 0;
+    CHECK(*(int*)radixHeapPeek(heap, &key) == 7 && key == 7, "radix heap peek min");
+    radixHeapPop(heap, &key);
+    CHECK(!radixHeapPush(heap, 3, &vals[0]), "radix heap rejects decreasing key");
+    CHECK(radixHeapPush(heap, 9, &vals[0]), "radix heap accepts key above last");
+    uint64_t last = key;
+    bool ordered = true;
+    while (!radixHeapIsEmpty(heap)) {
+        radixHeapPop(heap, &key);
+        if (key < last) ordered = false;
+        last = key;
+    }
+    CHECK(ordered, "radix heap pop order non-decreasing");
+    CHECK(last == 1000000, "radix heap last key");
+
+    // Peek must not raise the bound: a key between the last pop and the
+    // peeked minimum is still accepted and comes out first.
+    int more[] = {500, 2000000, 1500000};
+    radixHeapPush(heap, 2000000, &more[1]);
+    CHECK(radixHeapPeek(heap, &key) == &more[1] && key == 2000000, "radix heap peek above last pop");
+    CHECK(radixHeapPush(heap, 1500000, &more[2]), "radix heap accepts key below peeked min");
+    CHECK(radixHeapPeek(heap, &key) == &more[2] && radixHeapPop(heap, &key) == &more[2] && key == 1500000,
+          "radix heap pops key pushed after peek");
+    CHECK(!radixHeapPush(heap, 1000000, &more[0]), "radix heap bound follows pops");
+    freeRadixHeap(heap);
+}
+
+typedef struct IntRange {
+    int* values;
+    size_t pos;
+    size_t count;
+} IntRange;
+
+static void* int_range_next(void* state) {
+    IntRange* range = (IntRange*)state;
+    if (range->pos >= range->count) return NULL;
+    return &range->values[range->pos++];
+}
+
+static void test_merge_iterator(void) {
+    int a[] = {1, 4, 9};
+    int b[] = {2, 4, 8};
+    int c[] = {3, 5};
+    void* arr[] = {&a[0], &a[1], &a[2]};
+    SingleLinkedList* list = createSingleLinkedList();
+    for (size_t i = 0; i < 3; i++) SLL_insertBack(list, &b[i]);
+    IntRange range = {c, 0, 2};
+
+    MergeIterator* merge = createMergeIterator(intCompare);
+    mergeAddArray(merge, arr, 3);
+    mergeAddList(merge, list);
+    mergeAddSource(merge, int_range_next, &range);
+
+    CHECK(*(int*)mergeNext(merge) == 1, "merge first item");
+    void* out[16];
+    size_t n = mergeNextBatch(merge, out, 16);
+    CHECK(n == 7, "merge batch count");
+    bool ordered = true;
+    for (size_t i = 1; i < n; i++) {
+        if (*(int*)out[i - 1] > *(int*)out[i]) ordered = false;
+    }
+    CHECK(ordered, "merge batch sorted");
+    CHECK(out[2] == &a[1] && out[3] == &b[1], "merge stable on ties");
+    CHECK(!mergeHasNext(merge), "merge exhausted");
+    freeMergeIterator(merge);
+    SLL_freeList(list);
+}
+
+static void test_external_pq(void) {
+    // Budget for 8 in-memory records forces several spilled runs.
+    ExternalPQ* pq = createExternalPQ(sizeof(int), 8 * (sizeof(int) + 2 * sizeof(void*)), intCompare);
+    for (int i = 0; i < 50; i++) {
+        int value = (i * 37) % 50;
+        epqPush(pq, &value);
+    }
+    CHECK(epqSize(pq) == 50, "external pq size after pushes");
+    CHECK(epqRunCount(pq) > 0, "external pq spilled runs");
+    int value = -1;
+    CHECK(epqPeek(pq, &value) && value == 0, "external pq peek min");
+    bool ordered = true;
+    for (int expected = 0; expected < 50; expected++) {
+        if (!epqPop(pq, &value) || value != expected) ordered = false;
+    }
+    CHECK(ordered, "external pq pop order");
+    CHECK(epqIsEmpty(pq) && epqRunCount(pq) == 0, "external pq empty after pops");
+
+    // 75 spills: level 0 fills several times and two levels stay in use.
+    bool bounded = true;
+    for (int i = 0; i < 600; i++) {
+        value = (i * 211) % 600;
+        epqPush(pq, &value);
+        if (epqRunCount(pq) > 2 * (EPQ_MERGE_FANIN - 1)) bounded = false;
+        if (i == 300) epqPop(pq, &value);
+    }
+    CHECK(bounded && epqSize(pq) == 599, "external pq merges runs per level");
+    size_t levelOne = 0;
+    for (size_t i = 0; i < pq->runs->size; i++) {
+        if (((EPQRun*)pq->runs->data[i])->level == 1) levelOne++;
+    }
+    CHECK(levelOne == 75 / EPQ_MERGE_FANIN, "external pq tiered runs stay at their level");
+    ordered = true;
+    int prev = -1;
+    while (epqPop(pq, &value)) {
+        if (value <= prev) ordered = false;
+        prev = value;
+    }
+    CHECK(ordered && prev == 599 && epqIsEmpty(pq), "external pq pop order after merges");
+    freeExternalPQ(pq);
+}
+
+static int timer_fired[4];
+static size_t timer_fired_idx = 0;
+static void timer_record(TimerWheelTimer* timer, void* arg) {
+    (void)timer;
+    if (timer_fired_idx < sizeof(timer_fired) / sizeof(timer_fired[0])) {
+        timer_fired[timer_fired_idx++] = *(int*)arg;
+    }
+}
+
+static void test_timer_wheel(void) {
+    TimerWheel* wheel = createTimerWheel(100);
+    int ids[] = {1, 2, 3, 4};
+    TimerWheelTimer timers[4];
+    for (size_t i = 0; i < 4; i++) initTimer(&timers[i], timer_record, &ids[i]);
+    timerWheelSchedule(wheel, &timers[0], 105);
+    timerWheelSchedule(wheel, &timers[1], 400);
+    timerWheelSchedule(wheel, &timers[2], 70000);
+    timerWheelSchedule(wheel, &timers[3], 110);
+    CHECK(timerWheelSize(wheel) == 4, "timer wheel size after schedule");
+
+    CHECK(timerWheelCancel(wheel, &timers[3]), "timer wheel cancel pending");
+    CHECK(!timerIsPending(&timers[3]), "timer wheel cancelled not pending");
+
+    timer_fired_idx = 0;
+    CHECK(timerWheelAdvance(wheel, 104) == 0, "timer wheel nothing before expiry");
+    CHECK(timerWheelAdvance(wheel, 399) == 1, "timer wheel fires first timer");
+    CHECK(timerWheelAdvance(wheel, 400) == 1, "timer wheel fires cascaded timer");
+    CHECK(timerWheelAdvance(wheel, 69999) == 0, "timer wheel far timer not early");
+    CHECK(timerWheelAdvance(wheel, 70000) == 1, "timer wheel fires far timer");
+    CHECK(timer_fired_idx == 3 && timer_fired[0] == 1 && timer_fired[1] == 2 && timer_fired[2] == 3,
+          "timer wheel firing order");
+    CHECK(timerWheelSize(wheel) == 0, "timer wheel empty after firing");
+    freeTimerWheel(wheel);
+}
+
 static int map_order[8];
 static size_t map_idx = 0;
 static void map_visit(void* key, void* value) {
@@ -232,11 +1119,26 @@ static void test_graph(void) {
 
 static void run_all_tests(void) {
     test_linked_list();
+    test_unrolled_list();
+    test_intrusive_list();
+    test_skip_list();
+    test_arena_list();
+    test_lf_sorted_list();
     test_stack();
+    test_lf_stack();
     test_queue();
+    test_spsc_queue();
+    test_mpmc_queue();
+    test_blocking_queue();
     test_deque();
+    test_ws_deque();
     test_binary_tree();
     test_heap();
+    test_topk();
+    test_timer_wheel();
+    test_radix_heap();
+    test_merge_iterator();
+    test_external_pq();
     test_map_set();
     test_umap_uset();
     test_graph();